@@ -0,0 +1,55 @@
+#ifndef MATRIX_GF2_ALIGNED_ALLOCATOR_HPP
+#define MATRIX_GF2_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+namespace matrix_gf2 {
+
+/**
+ * @brief Аллокатор с выравниванием блоков памяти
+ *
+ * Используется для хранения строк матриц так, чтобы начало буфера
+ * совпадало с границей кэш-линии (и регистра SIMD).
+ *
+ * @tparam T Тип элементов
+ * @tparam Alignment Выравнивание в байтах (степень двойки)
+ */
+template <typename T, std::size_t Alignment = 64>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T),
+                                              std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* ptr, std::size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return false;
+    }
+};
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_ALIGNED_ALLOCATOR_HPP
@@ -0,0 +1,98 @@
+#ifndef MATRIX_GF2_BINARY_FIELD_HPP
+#define MATRIX_GF2_BINARY_FIELD_HPP
+
+#include <cstdint>
+#include <iostream>
+
+namespace matrix_gf2 {
+
+namespace detail {
+
+/**
+ * @brief Безпереносное (carry-less) умножение 64 x 64 -> 128 бит
+ *
+ * На x86-64 с поддержкой PCLMULQDQ используется аппаратная инструкция
+ * (наличие проверяется один раз во время выполнения), иначе - переносимая
+ * реализация с таблицей 4-битных окон.
+ *
+ * @param hi Старшие 64 бита произведения
+ * @param lo Младшие 64 бита произведения
+ */
+void clmul64(uint64_t a, uint64_t b, uint64_t& hi, uint64_t& lo);
+
+/**
+ * @brief Используется ли аппаратная инструкция PCLMULQDQ
+ */
+bool hasHardwareClmul();
+
+/**
+ * @brief Приведение произведения (hi, lo) по модулю x^m + r(x), m <= 64
+ *
+ * Старшая часть многократно "сворачивается" умножением на r(x); при
+ * 2 deg r <= m достаточно двух сверток.
+ *
+ * @param r Модуль без старшего члена x^m
+ */
+uint64_t clmulReduce(uint64_t hi, uint64_t lo, uint32_t m, uint64_t r);
+
+} // namespace detail
+
+/**
+ * @brief Элемент поля GF(2^128) = GF(2)[x] / (x^128 + r(x)), deg r < 64
+ *
+ * Элемент хранится в двух словах (бит i - коэффициент при x^i).
+ * Умножение выполняется тремя безпереносными умножениями (Карацуба)
+ * и двумя свертками старшей половины произведения.
+ */
+class GF2_128 {
+public:
+    // r(x) = x^7 + x^2 + x + 1 (модуль x^128 + x^7 + x^2 + x + 1)
+    static constexpr uint64_t kDefaultModulus = 0x87;
+
+    GF2_128(uint64_t lo = 0, uint64_t hi = 0) : lo_(lo), hi_(hi) {}
+
+    uint64_t lo() const { return lo_; }
+    uint64_t hi() const { return hi_; }
+
+    // Арифметические операции (по модулю kDefaultModulus)
+    GF2_128 operator+(const GF2_128& other) const {
+        return GF2_128(lo_ ^ other.lo_, hi_ ^ other.hi_);
+    }
+    GF2_128 operator-(const GF2_128& other) const { return *this + other; }
+    GF2_128 operator*(const GF2_128& other) const {
+        return mul(*this, other, kDefaultModulus);
+    }
+    GF2_128& operator+=(const GF2_128& other) { return *this = *this + other; }
+    GF2_128& operator-=(const GF2_128& other) { return *this = *this + other; }
+    GF2_128& operator*=(const GF2_128& other) { return *this = *this * other; }
+
+    /**
+     * @brief Умножение по модулю x^128 + r(x)
+     */
+    static GF2_128 mul(const GF2_128& a, const GF2_128& b, uint64_t r);
+
+    /**
+     * @brief Обратный элемент (a^(2^128 - 2))
+     * @throws std::invalid_argument для нулевого элемента
+     */
+    GF2_128 inverse() const;
+
+    bool isZero() const { return lo_ == 0 && hi_ == 0; }
+    bool isOne() const { return lo_ == 1 && hi_ == 0; }
+
+    bool operator==(const GF2_128& other) const {
+        return lo_ == other.lo_ && hi_ == other.hi_;
+    }
+    bool operator!=(const GF2_128& other) const { return !(*this == other); }
+
+    // Вывод в шестнадцатеричном виде (старшее слово первым)
+    friend std::ostream& operator<<(std::ostream& os, const GF2_128& elem);
+
+private:
+    uint64_t lo_;
+    uint64_t hi_;
+};
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_BINARY_FIELD_HPP
@@ -0,0 +1,147 @@
+#ifndef MATRIX_GF2_BIT_MATRIX_HPP
+#define MATRIX_GF2_BIT_MATRIX_HPP
+
+#include "aligned_allocator.hpp"
+#include "matrix.hpp"
+#include <cstdint>
+#include <vector>
+#include <optional>
+#include <iostream>
+
+namespace matrix_gf2 {
+
+// Результат исключения Гаусса для упакованной матрицы
+struct BitGaussResult;
+
+/**
+ * @brief Упакованная матрица над GF(2)
+ *
+ * Каждый элемент занимает один бит: 64 элемента строки хранятся в одном
+ * слове uint64_t. Строки выровнены по границе кэш-линии, поэтому
+ * элементарные преобразования строк выполняются как XOR/AND целыми словами.
+ * Биты за пределами cols() в последнем слове строки всегда равны нулю.
+ */
+class BitMatrix {
+public:
+    /**
+     * @brief Конструктор нулевой матрицы
+     * @param rows Количество строк
+     * @param cols Количество столбцов
+     */
+    BitMatrix(size_t rows = 0, size_t cols = 0);
+
+    /**
+     * @brief Конструктор из двумерного массива значений (берутся по модулю 2)
+     */
+    BitMatrix(const std::vector<std::vector<uint32_t>>& data);
+
+    // Создание специальных матриц
+    static BitMatrix identity(size_t n);
+    static BitMatrix zero(size_t rows, size_t cols);
+    static BitMatrix random(size_t rows, size_t cols);
+
+    /**
+     * @brief Преобразование из матрицы (или её представления) над GF(2)
+     * @throws std::invalid_argument если матрица задана не над GF(2)
+     */
+    static BitMatrix fromMatrix(const ConstMatrixView& mat);
+
+    /**
+     * @brief Преобразование в обычную матрицу над GF(2)
+     */
+    Matrix toMatrix() const;
+
+    // Размеры
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+
+    // Количество значащих слов в строке и шаг между строками (в словах)
+    size_t words() const { return words_; }
+    size_t stride() const { return stride_; }
+
+    // Доступ к элементам (с проверкой границ)
+    bool get(size_t i, size_t j) const;
+    void set(size_t i, size_t j, bool value);
+
+    // Прямой доступ к словам строки
+    uint64_t* row(size_t i) { return data_.data() + i * stride_; }
+    const uint64_t* row(size_t i) const { return data_.data() + i * stride_; }
+
+    // Операции с матрицами
+    BitMatrix operator+(const BitMatrix& other) const;
+    BitMatrix operator*(const BitMatrix& other) const;
+    BitMatrix& operator+=(const BitMatrix& other);
+
+    // Транспонирование
+    BitMatrix transpose() const;
+
+    // Элементарные преобразования строк
+    void swapRows(size_t i, size_t j);
+
+    /**
+     * @brief Прибавление строки src к строке dest (XOR по словам)
+     */
+    void addRow(size_t dest, size_t src);
+
+    /**
+     * @brief Прямой ход Гаусса (ступенчатый вид)
+     */
+    BitGaussResult forwardGauss() const;
+
+    /**
+     * @brief Полное исключение Гаусса-Жордана (RREF)
+     */
+    BitGaussResult reducedRowEchelonForm() const;
+
+    /**
+     * @brief Вычисление ранга матрицы
+     */
+    size_t rank() const;
+
+    /**
+     * @brief Проверка обратимости матрицы
+     */
+    bool isInvertible() const;
+
+    /**
+     * @brief Вычисление обратной матрицы
+     * @return Обратная матрица или nullopt, если матрица необратима
+     */
+    std::optional<BitMatrix> inverse() const;
+
+    // Операции сравнения
+    bool operator==(const BitMatrix& other) const;
+    bool operator!=(const BitMatrix& other) const;
+
+    // Вывод
+    friend std::ostream& operator<<(std::ostream& os, const BitMatrix& mat);
+
+private:
+    size_t rows_;
+    size_t cols_;
+    size_t words_;
+    size_t stride_;
+    std::vector<uint64_t, AlignedAllocator<uint64_t>> data_;
+
+    /**
+     * @brief Исключение Гаусса на месте (метод четырёх русских, M4RI)
+     * @param backward Обнулять также элементы над ведущими (RREF)
+     * @param pivotCols Индексы ведущих столбцов
+     * @return Ранг матрицы
+     */
+    size_t eliminate(bool backward, std::vector<size_t>& pivotCols);
+};
+
+// Результат исключения Гаусса для упакованной матрицы
+struct BitGaussResult {
+    BitMatrix matrix;
+    size_t rank = 0;
+    std::vector<size_t> pivotCols;
+
+    // Constructor
+    BitGaussResult(const BitMatrix& m) : matrix(m), rank(0) {}
+};
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_BIT_MATRIX_HPP
@@ -0,0 +1,218 @@
+#ifndef MATRIX_GF2_FIELD_HPP
+#define MATRIX_GF2_FIELD_HPP
+
+#include "wide_arith.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace matrix_gf2 {
+
+/**
+ * @brief Контекст конечного поля GF(p^m)
+ *
+ * Параметры поля (p, m и неприводимый полином) хранятся в единственном
+ * экземпляре на процесс: Field::get() возвращает ссылку на общий объект,
+ * который живёт до завершения программы. Элементы и матрицы хранят
+ * только указатель на него.
+ *
+ * Элемент поля представляется одним упакованным целым числом
+ * v = c_0 + c_1 p + ... + c_{m-1} p^{m-1}, где c_i - коэффициенты
+ * полинома. Для GF(p) это просто вычет по модулю p.
+ *
+ * Для расширений порядка не больше kMaxTableOrder при создании контекста
+ * строятся таблицы дискретных логарифмов и степеней примитивного элемента
+ * (а для p > 2 - таблица логарифмов Зеха), после чего умножение, деление,
+ * обращение и сложение сводятся к обращениям к таблицам. Для простых полей
+ * того же размера строится таблица обратных элементов; для больших p
+ * обратный находится расширенным алгоритмом Евклида.
+ *
+ * Умножение в GF(p) не использует аппаратное деление: для p < 2^32
+ * применяется редукция Барретта, для 2^32 <= p < 2^63 - умножение
+ * Монтгомери со 128-битными промежуточными значениями. В GF(2^m) без
+ * таблиц (m > 20) при модуле x^m + r(x) с 2 deg r <= m используется
+ * безпереносное умножение (PCLMULQDQ) и быстрая свертка по модулю.
+ */
+class Field {
+public:
+    // Наибольший порядок поля, для которого строятся таблицы логарифмов
+    static constexpr uint64_t kMaxTableOrder = uint64_t(1) << 20;
+
+    // Верхняя граница характеристики поля (не включительно)
+    static constexpr uint64_t kMaxPrime = uint64_t(1) << 63;
+    
+    /**
+     * @brief Получение (создание при первом обращении) контекста поля
+     * @param p Характеристика поля (простое число)
+     * @param m Степень расширения
+     * @param modulus Неприводимый полином (коэффициенты, начиная с младшего);
+     *                для m = 1 не используется
+     * @throws std::invalid_argument при некорректных параметрах
+     */
+    static const Field& get(uint64_t p, uint32_t m = 1,
+                            const std::vector<uint32_t>& modulus = {1, 1});
+
+    Field(const Field&) = delete;
+    Field& operator=(const Field&) = delete;
+
+    // Параметры поля
+    uint64_t p() const { return p_; }
+    uint32_t m() const { return m_; }
+    const std::vector<uint32_t>& modulus() const { return modulus_; }
+    
+    /**
+     * @brief Используются ли таблицы логарифмов
+     */
+    bool hasLogTables() const { return !exp_.empty(); }
+
+    /**
+     * @brief Наибольшее упакованное значение элемента (p^m - 1)
+     */
+    uint64_t maxValue() const { return maxValue_; }
+
+    // Арифметика над упакованными значениями
+    uint64_t add(uint64_t a, uint64_t b) const {
+        if (m_ == 1) {
+            uint64_t s = a + b;
+            return s >= p_ ? s - p_ : s;
+        }
+        return p_ == 2 ? (a ^ b) : addPoly(a, b);
+    }
+
+    uint64_t sub(uint64_t a, uint64_t b) const {
+        if (m_ == 1) {
+            return a >= b ? a - b : a + p_ - b;
+        }
+        return p_ == 2 ? (a ^ b) : subPoly(a, b);
+    }
+
+    uint64_t neg(uint64_t a) const {
+        return sub(0, a);
+    }
+
+    uint64_t mul(uint64_t a, uint64_t b) const {
+        if (m_ == 1) {
+            return p_ < kBarrettLimit ? reduceBarrett(a * b) : mulMontgomery(a, b);
+        }
+        if (!exp_.empty()) {
+            return (a == 0 || b == 0) ? 0 : exp_[log_[a] + log_[b]];
+        }
+        return mulPoly(a, b);
+    }
+
+    /**
+     * @brief Обратный элемент
+     * @throws std::invalid_argument для нулевого элемента
+     */
+    uint64_t inv(uint64_t a) const;
+
+    /**
+     * @brief Деление a / b
+     * @throws std::invalid_argument при делении на ноль
+     */
+    uint64_t div(uint64_t a, uint64_t b) const;
+
+    /**
+     * @brief Упакованное значение из целого числа (цифры в системе счисления p)
+     */
+    uint64_t fromInt(uint64_t value) const;
+
+    /**
+     * @brief Упакованное значение из коэффициентов полинома
+     *
+     * Полином произвольной степени приводится по модулю неприводимого полинома.
+     */
+    uint64_t fromCoeffs(const std::vector<uint32_t>& coeffs) const;
+
+    /**
+     * @brief Коэффициенты полинома (ровно m штук)
+     */
+    std::vector<uint32_t> toCoeffs(uint64_t value) const;
+
+private:
+    Field(uint64_t p, uint32_t m, const std::vector<uint32_t>& modulus);
+
+    // Для p < kBarrettLimit произведение двух вычетов помещается в 64 бита
+    static constexpr uint64_t kBarrettLimit = uint64_t(1) << 32;
+
+    uint64_t p_;
+    uint32_t m_;
+    std::vector<uint32_t> modulus_;  // Неприводимый полином степени m
+    uint64_t maxValue_;              // p^m - 1
+    uint32_t modulusLeadInv_;        // Обратный к старшему коэффициенту модуля
+    uint64_t binaryModulus_;         // Модуль без старшего члена (для p = 2)
+    bool useClmul_;                  // Умножение в GF(2^m) через CLMUL
+    uint64_t barrettMu_;             // floor((2^64 - 1) / p)
+    uint64_t montInv_;               // -p^(-1) mod 2^64
+    uint64_t montR2_;                // 2^128 mod p
+
+    // Редукция Барретта для x < p^2 (p < 2^32)
+    uint64_t reduceBarrett(uint64_t x) const {
+        uint64_t q = detail::mulHigh(x, barrettMu_);
+        uint64_t r = x - q * p_;
+        if (r >= p_) r -= p_;
+        if (r >= p_) r -= p_;
+        return r;
+    }
+
+    // Редукция Монтгомери: (hi * 2^64 + lo) * 2^(-64) mod p при hi < p
+    uint64_t reduceMontgomery(uint64_t hi, uint64_t lo) const {
+        uint64_t q = lo * montInv_;
+        uint64_t qpHi, qpLo;
+        detail::mulWide(q, p_, qpHi, qpLo);
+        // lo + qpLo = 0 (mod 2^64), перенос есть ровно тогда, когда lo != 0
+        uint64_t t = hi + qpHi + (lo != 0 ? 1 : 0);
+        return t >= p_ ? t - p_ : t;
+    }
+
+    // a * b mod p через два шага Монтгомери (без перевода в форму Монтгомери)
+    uint64_t mulMontgomery(uint64_t a, uint64_t b) const {
+        uint64_t hi, lo;
+        detail::mulWide(a, b, hi, lo);
+        uint64_t t = reduceMontgomery(hi, lo);
+        detail::mulWide(t, montR2_, hi, lo);
+        return reduceMontgomery(hi, lo);
+    }
+
+    // Подготовка констант редукции для GF(p)
+    void initReduction();
+
+    // Таблицы для малых расширений: exp_[i] = g^i (длина 2(q-1), чтобы не
+    // брать сумму логарифмов по модулю), log_[g^i] = i, zech_[k] = log(1 + g^k)
+    std::vector<uint32_t> exp_;
+    std::vector<uint32_t> log_;
+    std::vector<uint32_t> zech_;
+
+    // Таблица обратных элементов GF(p) для p <= kMaxTableOrder
+    std::vector<uint32_t> invTable_;
+
+    // Построение таблиц логарифмов (если найден примитивный элемент)
+    void buildLogTables();
+
+    // Построение таблицы обратных элементов GF(p)
+    void buildInverseTable();
+
+    /**
+     * @brief Обратный элемент в GF(p): по таблице или расширенным алгоритмом Евклида
+     */
+    uint64_t invModP(uint64_t a) const;
+
+    uint64_t addPoly(uint64_t a, uint64_t b) const;
+    uint64_t subPoly(uint64_t a, uint64_t b) const;
+    uint64_t mulPoly(uint64_t a, uint64_t b) const;
+
+    // Распаковка/упаковка коэффициентов (массив длины m)
+    void unpack(uint64_t value, uint32_t* digits) const;
+    uint64_t pack(const uint32_t* digits) const;
+
+    // Приведение полинома poly[0..len) по модулю неприводимого полинома;
+    // результат - первые m коэффициентов
+    void reducePoly(uint64_t* poly, size_t len) const;
+
+    // Возведение в степень
+    uint64_t pow(uint64_t a, uint64_t e) const;
+};
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_FIELD_HPP
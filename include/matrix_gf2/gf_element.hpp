@@ -1,6 +1,7 @@
 #ifndef MATRIX_GF2_GF_ELEMENT_HPP
 #define MATRIX_GF2_GF_ELEMENT_HPP
 
+#include "field.hpp"
 #include <cstdint>
 #include <vector>
 #include <iostream>
@@ -12,7 +13,8 @@ namespace matrix_gf2 {
  * 
  * Представляет элементы поля Галуа GF(p^m), где p - простое число,
  * m - степень расширения. Элементы хранятся как полиномы степени < m
- * с коэффициентами из GF(p).
+ * с коэффициентами из GF(p), упакованные в одно целое число; параметры
+ * поля находятся в общем контексте Field.
  */
 class GFElement {
 public:
@@ -22,7 +24,7 @@ public:
      * @param m Степень расширения
      * @param modulus Неприводимый полином (коэффициенты)
      */
-    GFElement(uint32_t p = 2, uint32_t m = 1, 
+    GFElement(uint64_t p = 2, uint32_t m = 1, 
               const std::vector<uint32_t>& modulus = {1, 1});
     
     /**
@@ -32,7 +34,7 @@ public:
      * @param m Степень расширения
      * @param modulus Неприводимый полином
      */
-    GFElement(uint32_t value, uint32_t p, uint32_t m,
+    GFElement(uint64_t value, uint64_t p, uint32_t m,
               const std::vector<uint32_t>& modulus = {1, 1});
     
     /**
@@ -42,9 +44,26 @@ public:
      * @param m Степень расширения
      * @param modulus Неприводимый полином
      */
-    GFElement(const std::vector<uint32_t>& coeffs, uint32_t p, uint32_t m,
+    GFElement(const std::vector<uint32_t>& coeffs, uint64_t p, uint32_t m,
               const std::vector<uint32_t>& modulus);
     
+    /**
+     * @brief Конструктор из контекста поля
+     * @param field Поле
+     * @param value Целочисленное значение элемента (цифры в системе счисления p)
+     */
+    explicit GFElement(const Field& field, uint64_t value = 0);
+    
+    /**
+     * @brief Создание элемента из упакованного значения без приведения
+     * @param raw Каноническое упакованное значение (не больше field.maxValue())
+     */
+    static GFElement fromRaw(const Field& field, uint64_t raw) {
+        GFElement result(field);
+        result.value_ = raw;
+        return result;
+    }
+    
     // Арифметические операции
     GFElement operator+(const GFElement& other) const;
     GFElement operator-(const GFElement& other) const;
@@ -71,41 +90,30 @@ public:
     bool isOne() const;
     
     // Получение характеристики и степени
-    uint32_t getP() const { return p_; }
-    uint32_t getM() const { return m_; }
+    uint64_t getP() const { return field_->p(); }
+    uint32_t getM() const { return field_->m(); }
+    
+    // Контекст поля
+    const Field& field() const { return *field_; }
     
     // Получение коэффициентов
-    const std::vector<uint32_t>& getCoeffs() const { return coeffs_; }
+    std::vector<uint32_t> getCoeffs() const { return field_->toCoeffs(value_); }
+    
+    // Получение значения (упакованное представление полинома)
+    uint64_t getValue() const { return value_; }
     
-    // Получение значения (для простых полей)
-    uint32_t getValue() const;
+    // Упакованное значение без копирования
+    uint64_t raw() const { return value_; }
     
     // Вывод
     friend std::ostream& operator<<(std::ostream& os, const GFElement& elem);
     
 private:
-    uint32_t p_;  // Характеристика поля
-    uint32_t m_;  // Степень расширения
-    std::vector<uint32_t> modulus_; // Неприводимый полином
-    std::vector<uint32_t> coeffs_;  // Коэффициенты полинома
-    
-    // Приведение по модулю p
-    void reduce();
-    
-    // Приведение по модулю неприводимого полинома
-    void reduceModulo();
-    
-    // Умножение полиномов
-    std::vector<uint32_t> polyMul(const std::vector<uint32_t>& a,
-                                   const std::vector<uint32_t>& b) const;
-    
-    // Деление полиномов с остатком
-    std::vector<uint32_t> polyMod(const std::vector<uint32_t>& a,
-                                   const std::vector<uint32_t>& b) const;
+    const Field* field_;  // Контекст поля
+    uint64_t value_;      // Упакованные коэффициенты полинома
     
-    // Расширенный алгоритм Евклида для полиномов
-    GFElement extGCD(const GFElement& a, const GFElement& b,
-                     GFElement& x, GFElement& y) const;
+    // Проверка принадлежности одному полю
+    void checkSameField(const GFElement& other) const;
 };
 
 } // namespace matrix_gf2
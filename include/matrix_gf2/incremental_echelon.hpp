@@ -0,0 +1,95 @@
+#ifndef MATRIX_GF2_INCREMENTAL_ECHELON_HPP
+#define MATRIX_GF2_INCREMENTAL_ECHELON_HPP
+
+#include "matrix.hpp"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace matrix_gf2 {
+
+/**
+ * @brief Ступенчатый базис, пополняемый по одной строке
+ *
+ * Строка состоит из коэффициентов (cols) и полезной нагрузки (payloadCols),
+ * как кодированный пакет сетевого кодирования: нагрузка - та же линейная
+ * комбинация исходных пакетов. Новая строка приводится по текущему базису
+ * за O(k * (cols + payloadCols)), где k - ранг, и добавляется, если она
+ * увеличивает ранг. В прогрессивном режиме базис поддерживается в
+ * приведённом виде (RREF): новый ведущий столбец сразу исключается из
+ * остальных строк, поэтому исходный пакет выдаётся, как только он
+ * определён, а при полном ранге решение готово без обратного хода.
+ */
+class IncrementalEchelon {
+public:
+    /**
+     * @brief Пустой базис
+     * @param cols Число коэффициентов строки
+     * @param field Поле
+     * @param payloadCols Длина полезной нагрузки строки
+     * @param progressive Поддерживать приведённый вид (RREF)
+     */
+    IncrementalEchelon(size_t cols, const Field& field, size_t payloadCols = 0,
+                       bool progressive = true);
+
+    // Размеры, ранг и поле
+    size_t cols() const { return cols_; }
+    size_t payloadCols() const { return payloadCols_; }
+    size_t rank() const { return pivots_.size(); }
+    bool isFullRank() const { return rank() == cols_; }
+    bool progressive() const { return progressive_; }
+    const Field& field() const { return *field_; }
+
+    /**
+     * @brief Добавление строки
+     * @param coefficients Коэффициенты (cols элементов)
+     * @param payload Полезная нагрузка (payloadCols элементов)
+     * @return true, если строка увеличила ранг (новая информация)
+     * @throws std::invalid_argument при несовпадении размера или поля
+     */
+    bool addRow(const std::vector<GFElement>& coefficients,
+                const std::vector<GFElement>& payload = {});
+
+    /**
+     * @brief Ведущие столбцы строк базиса в порядке их добавления
+     */
+    const std::vector<size_t>& pivotColumns() const { return pivots_; }
+
+    /**
+     * @brief Строки базиса: матрица rank x (cols + payloadCols)
+     *        (ведущие элементы равны единице)
+     */
+    Matrix basis() const;
+
+    /**
+     * @brief Нагрузка исходной строки col, если она уже однозначно
+     *        определена полученными строками
+     * @note Без прогрессивного режима определяется только при полном ранге
+     * @throws std::out_of_range если col >= cols
+     */
+    std::optional<std::vector<GFElement>> decoded(size_t col) const;
+
+    /**
+     * @brief Решение X (cols x payloadCols): coefficients * X = payload для
+     *        всех добавленных строк
+     * @return nullopt, пока ранг не полный
+     */
+    std::optional<Matrix> solution() const;
+
+private:
+    size_t width() const { return cols_ + payloadCols_; }
+    const uint64_t* basisRow(size_t k) const { return rows_.data() + k * width(); }
+    uint64_t* basisRow(size_t k) { return rows_.data() + k * width(); }
+
+    size_t cols_;
+    size_t payloadCols_;
+    const Field* field_;
+    bool progressive_;
+    std::vector<uint64_t> rows_;         // rank x width, в порядке добавления
+    std::vector<size_t> pivots_;         // Ведущий столбец строки k
+    std::vector<size_t> rowOfPivot_;     // Строка с ведущим столбцом (или cols_)
+};
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_INCREMENTAL_ECHELON_HPP
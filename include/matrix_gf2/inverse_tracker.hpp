@@ -0,0 +1,83 @@
+#ifndef MATRIX_GF2_INVERSE_TRACKER_HPP
+#define MATRIX_GF2_INVERSE_TRACKER_HPP
+
+#include "matrix.hpp"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace matrix_gf2 {
+
+/**
+ * @brief Квадратная матрица вместе с обратной, обновляемые за O(n^2)
+ *
+ * Обратная матрица вычисляется один раз (PLUQ), а после замены строки,
+ * столбца или прибавления u * v^T пересчитывается по формуле
+ * Шермана-Моррисона:
+ *   (A + u v^T)^-1 = A^-1 - (A^-1 u)(v^T A^-1) / (1 + v^T A^-1 u).
+ * Если знаменатель равен нулю, обновлённая матрица вырождена: изменение
+ * отклоняется, и матрица с обратной остаются прежними. Определитель
+ * отслеживается так же: det(A + u v^T) = det(A) * (1 + v^T A^-1 u).
+ */
+class InverseTracker {
+public:
+    /**
+     * @brief Начало отслеживания
+     * @param options Пул потоков для вычисления обратной
+     * @return nullopt, если матрица не квадратная или вырождена
+     */
+    static std::optional<InverseTracker> create(
+        const Matrix& a, const EliminationOptions& options = EliminationOptions());
+
+    // Размер и поле
+    size_t size() const { return n_; }
+    const Field& field() const { return *field_; }
+
+    // Текущая матрица, её обратная и определитель
+    Matrix matrix() const;
+    Matrix inverse() const;
+    GFElement determinant() const { return GFElement::fromRaw(*field_, det_); }
+
+    /**
+     * @brief A += u * v^T
+     * @return false, если матрица стала бы вырожденной (изменение отклонено)
+     * @throws std::invalid_argument при несовпадении размера или поля
+     */
+    bool rankOneUpdate(const std::vector<GFElement>& u, const std::vector<GFElement>& v);
+
+    /**
+     * @brief Замена строки i
+     * @return false, если матрица стала бы вырожденной (изменение отклонено)
+     * @throws std::out_of_range если i >= size()
+     * @throws std::invalid_argument при несовпадении размера или поля
+     */
+    bool replaceRow(size_t i, const std::vector<GFElement>& row);
+
+    /**
+     * @brief Замена столбца j
+     * @return false, если матрица стала бы вырожденной (изменение отклонено)
+     * @throws std::out_of_range если j >= size()
+     * @throws std::invalid_argument при несовпадении размера или поля
+     */
+    bool replaceColumn(size_t j, const std::vector<GFElement>& col);
+
+private:
+    InverseTracker(size_t n, const Field& field);
+
+    std::vector<uint64_t> pack(const std::vector<GFElement>& v) const;
+
+    // Обновление обратной и определителя по w = A^-1 u, z = v^T A^-1 и
+    // d = 1 + v^T A^-1 u; false при d = 0 (сама матрица обновляется вызывающим)
+    bool apply(const std::vector<uint64_t>& w, const std::vector<uint64_t>& z, uint64_t d);
+
+    size_t n_;
+    const Field* field_;
+    ThreadPool* pool_ = nullptr;
+    std::vector<uint64_t> a_;    // n x n
+    std::vector<uint64_t> inv_;  // n x n
+    uint64_t det_ = 0;
+};
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_INVERSE_TRACKER_HPP
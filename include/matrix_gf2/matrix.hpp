@@ -1,16 +1,22 @@
 #ifndef MATRIX_GF2_MATRIX_HPP
 #define MATRIX_GF2_MATRIX_HPP
 
+#include "aligned_allocator.hpp"
 #include "gf_element.hpp"
 #include <vector>
 #include <string>
 #include <optional>
 #include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace matrix_gf2 {
 
 // Forward declaration
 class Matrix;
+class ThreadPool;
+class PLUQ;
 
 // Result structure for Gaussian elimination
 struct GaussResult;
@@ -18,8 +24,55 @@ struct GaussResult;
 // Submatrix information  
 struct SubmatrixInfo;
 
+// Представления без копирования (M - Matrix или const Matrix)
+template <typename M> class BasicRowView;
+template <typename M> class BasicColumnView;
+template <typename M> class BasicMatrixView;
+using RowView = BasicRowView<Matrix>;
+using ConstRowView = BasicRowView<const Matrix>;
+using ColumnView = BasicColumnView<Matrix>;
+using ConstColumnView = BasicColumnView<const Matrix>;
+using MatrixView = BasicMatrixView<Matrix>;
+using ConstMatrixView = BasicMatrixView<const Matrix>;
+
+/**
+ * @brief Параметры умножения матриц
+ */
+struct MultiplyOptions {
+    // Размер (минимум из трёх измерений), начиная с которого применяется
+    // алгоритм Штрассена-Винограда; 0 - только классическое умножение.
+    // Если не задан, выбирается по полю: 512 для простых полей с p <= 2^32
+    // (быстрое классическое ядро с отложенным приведением), иначе 128
+    std::optional<size_t> strassenThreshold;
+
+    // Разрешить точное умножение над GF(p), p < 2^26, в арифметике double
+    // на векторных FMA-ядрах (используется, если процессор их поддерживает)
+    bool floatingPoint = true;
+
+    // Пул потоков для больших произведений; nullptr - ThreadPool::global()
+    ThreadPool* pool = nullptr;
+};
+
+/**
+ * @brief Параметры параллельного исключения Гаусса
+ *
+ * Методы с этим параметром выполняют блочное исключение: столбцы
+ * обрабатываются панелями, обновления строк распределяются по потокам,
+ * а остаток матрицы обновляется параллельным умножением блоков.
+ * Результат совпадает с последовательным алгоритмом.
+ */
+struct EliminationOptions {
+    // Пул потоков; nullptr - ThreadPool::global(), пул размера 1 - без потоков
+    ThreadPool* pool = nullptr;
+};
+
 /**
  * @brief Класс для представления матрицы над полем GF(p^m)
+ *
+ * Элементы хранятся в одном непрерывном буфере, выровненном по кэш-линии;
+ * шаг между строками (stride) дополняется до целого числа кэш-линий.
+ * Логические строки отображаются на физические через таблицу перестановки,
+ * поэтому swapRows выполняется за O(1).
  */
 class Matrix {
 public:
@@ -31,7 +84,7 @@ public:
      * @param m Степень расширения
      * @param modulus Неприводимый полином
      */
-    Matrix(size_t rows, size_t cols, uint32_t p = 2, uint32_t m = 1,
+    Matrix(size_t rows, size_t cols, uint64_t p = 2, uint32_t m = 1,
            const std::vector<uint32_t>& modulus = {1, 1});
     
     /**
@@ -42,32 +95,56 @@ public:
      * @param modulus Неприводимый полином
      */
     Matrix(const std::vector<std::vector<uint32_t>>& data,
-           uint32_t p = 2, uint32_t m = 1,
+           uint64_t p = 2, uint32_t m = 1,
            const std::vector<uint32_t>& modulus = {1, 1});
     
+    /**
+     * @brief Конструктор нулевой матрицы над заданным полем
+     * @param rows Количество строк
+     * @param cols Количество столбцов
+     * @param field Поле
+     */
+    Matrix(size_t rows, size_t cols, const Field& field);
+    
     /**
      * @brief Конструктор из двумерного массива элементов GF
-     * @note Используется стандартный модуль {1, 1} для простых полей GF(p)
+     * @note Поле берётся из первого элемента (GF(2) для пустой матрицы)
      */
     Matrix(const std::vector<std::vector<GFElement>>& data);
     
+    /**
+     * @brief Копия представления (блока или транспонированной матрицы)
+     */
+    explicit Matrix(const ConstMatrixView& view);
+    
     // Создание специальных матриц
-    static Matrix identity(size_t n, uint32_t p = 2, uint32_t m = 1,
+    static Matrix identity(size_t n, uint64_t p = 2, uint32_t m = 1,
                           const std::vector<uint32_t>& modulus = {1, 1});
-    static Matrix zero(size_t rows, size_t cols, uint32_t p = 2, uint32_t m = 1,
+    static Matrix zero(size_t rows, size_t cols, uint64_t p = 2, uint32_t m = 1,
                       const std::vector<uint32_t>& modulus = {1, 1});
-    static Matrix random(size_t rows, size_t cols, uint32_t p = 2, uint32_t m = 1,
+    static Matrix random(size_t rows, size_t cols, uint64_t p = 2, uint32_t m = 1,
                         const std::vector<uint32_t>& modulus = {1, 1});
     
     // Размеры
     size_t rows() const { return rows_; }
     size_t cols() const { return cols_; }
     
-    // Доступ к элементам
+    // Шаг между физическими строками (в элементах)
+    size_t stride() const { return stride_; }
+    
+    // Доступ к элементам: at - с проверкой границ, operator() - без проверки
     GFElement& at(size_t i, size_t j);
     const GFElement& at(size_t i, size_t j) const;
-    GFElement& operator()(size_t i, size_t j);
-    const GFElement& operator()(size_t i, size_t j) const;
+    GFElement& operator()(size_t i, size_t j) { return rowData(i)[j]; }
+    const GFElement& operator()(size_t i, size_t j) const { return rowData(i)[j]; }
+    
+    /**
+     * @brief Прямой доступ к строке i (cols() элементов подряд, без проверки границ)
+     * @note Указатель действителен до изменения размеров матрицы; после
+     *       swapRows строка i указывает на другой участок буфера
+     */
+    GFElement* rowData(size_t i) { return data_.data() + rowIndex_[i] * stride_; }
+    const GFElement* rowData(size_t i) const { return data_.data() + rowIndex_[i] * stride_; }
     
     // Операции с матрицами
     Matrix operator+(const Matrix& other) const;
@@ -77,6 +154,15 @@ public:
     Matrix& operator+=(const Matrix& other);
     Matrix& operator-=(const Matrix& other);
     
+    /**
+     * @brief Умножение матриц с параметрами (operator* - с параметрами по умолчанию)
+     *
+     * Над GF(2) используется BitMatrix (M4RM), над остальными полями -
+     * алгоритм Штрассена-Винограда с переходом к классическому
+     * блочному умножению на малых размерах.
+     */
+    Matrix multiply(const Matrix& other, const MultiplyOptions& options = MultiplyOptions()) const;
+    
     // Умножение на скаляр
     Matrix operator*(const GFElement& scalar) const;
     Matrix& operator*=(const GFElement& scalar);
@@ -87,7 +173,28 @@ public:
     // Транспонирование
     Matrix transpose() const;
     
-    // Получение строки/столбца
+    /**
+     * @brief Представления строки, столбца и блока без копирования
+     *
+     * Изменения через представление изменяемой матрицы видны в ней самой.
+     * Представление действительно, пока матрица существует и не меняет
+     * размеров; строки и столбцы адресуются по логическим индексам на
+     * момент обращения (кроме RowView, указывающей на участок буфера).
+     *
+     * @throws std::out_of_range если индекс или блок выходит за границы
+     */
+    RowView row(size_t i);
+    ConstRowView row(size_t i) const;
+    ColumnView col(size_t j);
+    ConstColumnView col(size_t j) const;
+    MatrixView block(size_t row0, size_t col0, size_t rows, size_t cols);
+    ConstMatrixView block(size_t row0, size_t col0, size_t rows, size_t cols) const;
+    
+    // Представление всей матрицы (view().transposed() - ленивое транспонирование)
+    MatrixView view();
+    ConstMatrixView view() const;
+    
+    // Получение строки/столбца (копии)
     std::vector<GFElement> getRow(size_t i) const;
     std::vector<GFElement> getCol(size_t j) const;
     void setRow(size_t i, const std::vector<GFElement>& row);
@@ -104,8 +211,11 @@ public:
      * @brief Прямой ход Гаусса (приведение к ступенчатому виду)
      * @param educational Включить учебный режим с объяснениями
      * @return Результат с преобразованной матрицей и информацией
+     * @note Над GF(2) без учебного режима (здесь и в reducedRowEchelonForm,
+     *       rank, inverse) используется упакованное исключение M4RI
      */
     GaussResult forwardGauss(bool educational = false) const;
+    GaussResult forwardGauss(const EliminationOptions& options) const;
     
     /**
      * @brief Обратный ход Гаусса (приведение к систематическому виду)
@@ -120,11 +230,13 @@ public:
      * @return Результат с преобразованной матрицей и информацией
      */
     GaussResult reducedRowEchelonForm(bool educational = false) const;
+    GaussResult reducedRowEchelonForm(const EliminationOptions& options) const;
     
     /**
      * @brief Вычисление ранга матрицы
      */
     size_t rank() const;
+    size_t rank(const EliminationOptions& options) const;
     
     /**
      * @brief Проверка обратимости матрицы
@@ -134,19 +246,50 @@ public:
     /**
      * @brief Вычисление обратной матрицы
      * @return Обратная матрица или nullopt, если матрица необратима
+     * @note Без учебного режима большие матрицы обращаются блочно через
+     *       дополнение Шура, так что основная работа приходится на умножение
      */
     std::optional<Matrix> inverse(bool educational = false) const;
+    std::optional<Matrix> inverse(const EliminationOptions& options) const;
+    
+    /**
+     * @brief Обращение на месте методом Гаусса-Жордана без расширенной матрицы
+     *
+     * Столбцы обратной записываются на место исключённых столбцов, а
+     * перестановки строк учитываются перестановкой столбцов в конце:
+     * дополнительная память - O(n), арифметика - n^3 вместо 2n^3.
+     *
+     * @return false для неквадратной или вырожденной матрицы; вырожденность
+     *         обнаруживается на первом отсутствующем ведущем элементе, и
+     *         матрица остаётся частично преобразованной (над GF(2) - прежней)
+     */
+    bool invertInPlace();
+    
+    /**
+     * @brief Разложение A = P * L * U * Q для многократного решения систем
+     * @note Объявлено в pluq.hpp
+     */
+    PLUQ pluq(const EliminationOptions& options = EliminationOptions()) const;
     
     /**
      * @brief Поиск обратимой подматрицы максимального размера
-     * @return Индексы строк и столбцов обратимой подматрицы
+     *
+     * Размер подматрицы равен рангу; строки и столбцы - профили ранга
+     * из одного разложения PLUQ (лексикографически первые наборы).
+     *
+     * @param options Пул потоков для исключения
+     * @return Индексы строк и столбцов обратимой подматрицы или nullopt
+     *         для нулевой матрицы
      */
-    std::optional<SubmatrixInfo> findInvertibleSubmatrix() const;
+    std::optional<SubmatrixInfo> findInvertibleSubmatrix(
+        const EliminationOptions& options = EliminationOptions()) const;
     
     /**
      * @brief Извлечение подматрицы
      * @param rowIndices Индексы строк
      * @param colIndices Индексы столбцов
+     * @note Подматрица копируется; для смежных строк и столбцов без
+     *       копирования используется block()
      */
     Matrix submatrix(const std::vector<size_t>& rowIndices,
                     const std::vector<size_t>& colIndices) const;
@@ -160,24 +303,260 @@ public:
     std::string toString() const;
     
     // Параметры поля
-    uint32_t getP() const { return p_; }
-    uint32_t getM() const { return m_; }
+    uint64_t getP() const { return field_->p(); }
+    uint32_t getM() const { return field_->m(); }
+    const Field& field() const { return *field_; }
     
 private:
     size_t rows_;
     size_t cols_;
-    uint32_t p_;
-    uint32_t m_;
-    std::vector<uint32_t> modulus_;
-    std::vector<std::vector<GFElement>> data_;
+    size_t stride_;
+    const Field* field_;
+    std::vector<GFElement, AlignedAllocator<GFElement>> data_;
+    std::vector<size_t> rowIndex_;  // Логическая строка -> физическая
+    
+    // Матрица над GF(2): операции выполняются через BitMatrix
+    bool isBinary() const { return field_->p() == 2 && field_->m() == 1; }
     
     // Вспомогательные функции для Гаусса
     GaussResult gaussElimination(bool forward, bool backward, bool educational) const;
     
+    // Блочное (параллельное) исключение Гаусса над упакованными значениями
+    GaussResult blockedElimination(bool backward, const EliminationOptions& options) const;
+    
+    // Обращение методом Гаусса-Жордана: в учебном режиме и при заданных
+    // options - через расширенную матрицу [A | I], иначе на месте (копии)
+    std::optional<Matrix> inverseGaussJordan(bool educational,
+                                             const EliminationOptions* options = nullptr) const;
+    
+    // Блочное обращение через дополнение Шура
+    std::optional<Matrix> blockInverse(const MultiplyOptions& options,
+                                       const EliminationOptions* elimination = nullptr) const;
+    
     // Поиск ведущего элемента
     std::optional<size_t> findPivot(const Matrix& mat, size_t col, size_t startRow) const;
 };
 
+namespace detail {
+
+// Тип элемента представления: константный для представлений const Matrix
+template <typename M>
+using ViewElement = std::conditional_t<std::is_const_v<M>, const GFElement, GFElement>;
+
+// Представление изменяемой матрицы приводится к константному, но не наоборот
+template <typename To, typename From>
+using EnableViewConversion = std::enable_if_t<std::is_const_v<To> && !std::is_const_v<From>>;
+
+} // namespace detail
+
+/**
+ * @brief Строка матрицы без копирования: size() элементов подряд
+ *
+ * Указывает на участок буфера матрицы, поэтому после swapRows остаётся
+ * связанной с прежней физической строкой.
+ */
+template <typename M>
+class BasicRowView {
+public:
+    using Element = detail::ViewElement<M>;
+    
+    BasicRowView(Element* data, size_t size) : data_(data), size_(size) {}
+    
+    template <typename Other, typename = detail::EnableViewConversion<M, Other>>
+    BasicRowView(const BasicRowView<Other>& other) : data_(other.data()), size_(other.size()) {}
+    
+    size_t size() const { return size_; }
+    Element* data() const { return data_; }
+    Element* begin() const { return data_; }
+    Element* end() const { return data_ + size_; }
+    
+    // Доступ без проверки границ и с проверкой
+    Element& operator[](size_t j) const { return data_[j]; }
+    Element& at(size_t j) const {
+        if (j >= size_) {
+            throw std::out_of_range("Индекс столбца вне границ");
+        }
+        return data_[j];
+    }
+    
+    std::vector<GFElement> toVector() const { return std::vector<GFElement>(begin(), end()); }
+    
+private:
+    Element* data_;
+    size_t size_;
+};
+
+/**
+ * @brief Столбец матрицы без копирования
+ *
+ * Строки хранятся с шагом stride() через таблицу перестановки, поэтому
+ * элемент i берётся из логической строки rowOffset() + i матрицы.
+ */
+template <typename M>
+class BasicColumnView {
+public:
+    using Element = detail::ViewElement<M>;
+    
+    // Без проверки границ (проверяет Matrix::col)
+    BasicColumnView(M& matrix, size_t row0, size_t col, size_t size)
+        : matrix_(&matrix), row0_(row0), col_(col), size_(size) {}
+    
+    template <typename Other, typename = detail::EnableViewConversion<M, Other>>
+    BasicColumnView(const BasicColumnView<Other>& other)
+        : matrix_(&other.matrix()), row0_(other.rowOffset()), col_(other.column()),
+          size_(other.size()) {}
+    
+    size_t size() const { return size_; }
+    M& matrix() const { return *matrix_; }
+    size_t rowOffset() const { return row0_; }
+    size_t column() const { return col_; }
+    
+    // Доступ без проверки границ и с проверкой
+    Element& operator[](size_t i) const { return matrix_->rowData(row0_ + i)[col_]; }
+    Element& at(size_t i) const {
+        if (i >= size_) {
+            throw std::out_of_range("Индекс строки вне границ");
+        }
+        return (*this)[i];
+    }
+    
+    std::vector<GFElement> toVector() const {
+        std::vector<GFElement> result;
+        result.reserve(size_);
+        for (size_t i = 0; i < size_; ++i) {
+            result.push_back((*this)[i]);
+        }
+        return result;
+    }
+    
+private:
+    M* matrix_;
+    size_t row0_;
+    size_t col_;
+    size_t size_;
+};
+
+/**
+ * @brief Блок матрицы без копирования, возможно транспонированный
+ *
+ * Блок задаётся смещением (rowOffset(), colOffset()) и размерами в
+ * координатах исходной матрицы; транспонирование только меняет порядок
+ * индексов при обращении. Константное представление неявно создаётся
+ * из матрицы, поэтому операции над представлениями принимают и Matrix;
+ * представление временной матрицы действительно до конца выражения.
+ */
+template <typename M>
+class BasicMatrixView {
+public:
+    using Element = detail::ViewElement<M>;
+    
+    // Вся матрица
+    BasicMatrixView(M& matrix)
+        : BasicMatrixView(matrix, 0, 0, matrix.rows(), matrix.cols()) {}
+    
+    // Блок rows x cols исходной матрицы без проверки границ (проверяет Matrix::block)
+    BasicMatrixView(M& matrix, size_t row0, size_t col0, size_t rows, size_t cols,
+                    bool transposed = false)
+        : matrix_(&matrix), row0_(row0), col0_(col0), rows_(rows), cols_(cols),
+          transposed_(transposed) {}
+    
+    template <typename Other, typename = detail::EnableViewConversion<M, Other>>
+    BasicMatrixView(const BasicMatrixView<Other>& other)
+        : matrix_(&other.matrix()), row0_(other.rowOffset()), col0_(other.colOffset()),
+          rows_(other.isTransposed() ? other.cols() : other.rows()),
+          cols_(other.isTransposed() ? other.rows() : other.cols()),
+          transposed_(other.isTransposed()) {}
+    
+    // Размеры представления (с учётом транспонирования)
+    size_t rows() const { return transposed_ ? cols_ : rows_; }
+    size_t cols() const { return transposed_ ? rows_ : cols_; }
+    const Field& field() const { return matrix_->field(); }
+    
+    // Исходная матрица и положение блока в ней
+    M& matrix() const { return *matrix_; }
+    size_t rowOffset() const { return row0_; }
+    size_t colOffset() const { return col0_; }
+    bool isTransposed() const { return transposed_; }
+    
+    // Доступ без проверки границ и с проверкой
+    Element& operator()(size_t i, size_t j) const {
+        return transposed_ ? matrix_->rowData(row0_ + j)[col0_ + i]
+                           : matrix_->rowData(row0_ + i)[col0_ + j];
+    }
+    Element& at(size_t i, size_t j) const {
+        if (i >= rows() || j >= cols()) {
+            throw std::out_of_range("Индекс вне границ матрицы");
+        }
+        return (*this)(i, j);
+    }
+    
+    /**
+     * @brief Строка i блока исходной матрицы (cols_ элементов подряд)
+     * @note Для транспонированного представления - его столбец i
+     */
+    Element* rowData(size_t i) const { return matrix_->rowData(row0_ + i) + col0_; }
+    
+    /**
+     * @brief Блок представления
+     * @throws std::out_of_range если блок выходит за границы
+     */
+    BasicMatrixView block(size_t row0, size_t col0, size_t rows, size_t cols) const {
+        if (row0 > this->rows() || rows > this->rows() - row0 ||
+            col0 > this->cols() || cols > this->cols() - col0) {
+            throw std::out_of_range("Блок выходит за границы матрицы");
+        }
+        return transposed_ ? BasicMatrixView(*matrix_, row0_ + col0, col0_ + row0, cols, rows, true)
+                           : BasicMatrixView(*matrix_, row0_ + row0, col0_ + col0, rows, cols);
+    }
+    
+    // Ленивое транспонирование
+    BasicMatrixView transposed() const {
+        return BasicMatrixView(*matrix_, row0_, col0_, rows_, cols_, !transposed_);
+    }
+    
+    Matrix toMatrix() const { return Matrix(*this); }
+    
+    /**
+     * @brief Копирование src в блок (только для изменяемой матрицы)
+     * @note src не должно перекрываться с блоком
+     * @throws std::invalid_argument при несовпадении размеров
+     */
+    void assign(const BasicMatrixView<const Matrix>& src) const {
+        static_assert(!std::is_const_v<M>, "Представление константной матрицы");
+        if (src.rows() != rows() || src.cols() != cols()) {
+            throw std::invalid_argument("Размеры матриц не совпадают");
+        }
+        for (size_t i = 0; i < rows(); ++i) {
+            for (size_t j = 0; j < cols(); ++j) {
+                (*this)(i, j) = src(i, j);
+            }
+        }
+    }
+    
+private:
+    M* matrix_;
+    size_t row0_;
+    size_t col0_;
+    size_t rows_;   // Размеры блока исходной матрицы
+    size_t cols_;
+    bool transposed_;
+};
+
+/**
+ * @brief Операции над представлениями
+ *
+ * Результат - новая матрица; Matrix приводится к ConstMatrixView неявно,
+ * так что операнды можно смешивать. Ошибки - как у методов Matrix.
+ */
+Matrix multiply(const ConstMatrixView& a, const ConstMatrixView& b,
+                const MultiplyOptions& options = MultiplyOptions());
+Matrix operator*(const ConstMatrixView& a, const ConstMatrixView& b);
+Matrix operator+(const ConstMatrixView& a, const ConstMatrixView& b);
+Matrix operator-(const ConstMatrixView& a, const ConstMatrixView& b);
+std::vector<GFElement> operator*(const ConstMatrixView& a, const std::vector<GFElement>& vec);
+bool operator==(const ConstMatrixView& a, const ConstMatrixView& b);
+bool operator!=(const ConstMatrixView& a, const ConstMatrixView& b);
+
 // Gaussian elimination result structure
 struct GaussResult {
     Matrix matrix;
@@ -186,7 +565,7 @@ struct GaussResult {
     std::vector<std::string> steps;
     
     // Constructor
-    GaussResult(const Matrix& m) : matrix(m), rank(0) {}
+    GaussResult(Matrix m) : matrix(std::move(m)), rank(0) {}
 };
 
 // Submatrix information structure
@@ -196,7 +575,7 @@ struct SubmatrixInfo {
     Matrix submatrix;
     
     // Constructor
-    SubmatrixInfo(const Matrix& m) : submatrix(m) {}
+    SubmatrixInfo(Matrix m) : submatrix(std::move(m)) {}
 };
 
 } // namespace matrix_gf2
@@ -0,0 +1,135 @@
+#ifndef MATRIX_GF2_PLUQ_HPP
+#define MATRIX_GF2_PLUQ_HPP
+
+#include "matrix.hpp"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace matrix_gf2 {
+
+/**
+ * @brief Разложение A = P * L * U * Q матрицы над GF(p^m)
+ *
+ * A имеет размер m x n и ранг r. P (m x m) и Q (n x n) - матрицы
+ * перестановок, L (m x r) - нижняя трапециевидная с ненулевой диагональю,
+ * U (r x n) = [U1 | U2], где U1 - верхняя треугольная с единичной
+ * диагональю. Разложение вычисляется один раз блочным исключением Гаусса
+ * (как forwardGauss(EliminationOptions)), после чего решение систем,
+ * определитель, ядро и обратная матрица получаются из сохранённых
+ * множителей без повторного исключения. Треугольные подстановки
+ * выполняются блоками, а обновление остальных строк - умножением блоков
+ * (в пуле потоков, заданном при разложении).
+ */
+class PLUQ {
+public:
+    /**
+     * @brief Разложение матрицы
+     * @param options Пул потоков для исключения
+     */
+    static PLUQ factor(const Matrix& a, const EliminationOptions& options = EliminationOptions());
+
+    // Размеры исходной матрицы и ранг
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+    size_t rank() const { return pivots_.size(); }
+    const Field& field() const { return *field_; }
+
+    /**
+     * @brief Перестановка строк: строка i произведения L * U * Q -
+     *        строка rowPermutation()[i] матрицы A
+     */
+    const std::vector<size_t>& rowPermutation() const { return rowPerm_; }
+
+    /**
+     * @brief Перестановка столбцов: столбец j матрицы U - столбец
+     *        columnPermutation()[j] матрицы A (сначала ведущие столбцы)
+     */
+    const std::vector<size_t>& columnPermutation() const { return colPerm_; }
+
+    // Множители в виде матриц: A == P() * L() * U() * Q()
+    Matrix P() const;
+    Matrix L() const;
+    Matrix U() const;
+    Matrix Q() const;
+
+    /**
+     * @brief Профиль ранга по столбцам: первые слева линейно независимые
+     *        столбцы A (возрастающие индексы)
+     */
+    const std::vector<size_t>& columnRankProfile() const { return pivots_; }
+
+    /**
+     * @brief Профиль ранга по строкам: первые сверху линейно независимые
+     *        строки A (возрастающие индексы)
+     * @note Вычисляется при каждом вызове исключением по L (r x m)
+     */
+    std::vector<size_t> rowRankProfile() const;
+
+    /**
+     * @brief Решение системы A * x = b
+     * @return Частное решение (свободные переменные равны нулю) или
+     *         nullopt, если система несовместна
+     * @throws std::invalid_argument при несовпадении размера или поля
+     */
+    std::optional<std::vector<GFElement>> solve(const std::vector<GFElement>& b) const;
+
+    /**
+     * @brief Решение A * X = B сразу для всех столбцов B
+     * @return X (n x k) или nullopt, если хотя бы одна система несовместна
+     * @throws std::invalid_argument при несовпадении размера или поля
+     */
+    std::optional<Matrix> solve(const Matrix& b) const;
+
+    /**
+     * @brief Решение A * X = B с поиском несовместных систем
+     * @param inconsistentColumns Номера столбцов B, для которых система
+     *        несовместна (соответствующие столбцы X нулевые)
+     * @return X (n x k)
+     * @throws std::invalid_argument при несовпадении размера или поля
+     */
+    Matrix solve(const Matrix& b, std::vector<size_t>& inconsistentColumns) const;
+
+    /**
+     * @brief Определитель
+     * @throws std::invalid_argument для неквадратной матрицы
+     */
+    GFElement determinant() const;
+
+    /**
+     * @brief Базис правого ядра: столбцы матрицы n x (n - r), A * N = 0
+     */
+    Matrix nullspace() const;
+
+    /**
+     * @brief Обратная матрица или nullopt, если A вырождена или не квадратная
+     */
+    std::optional<Matrix> inverse() const;
+
+private:
+    PLUQ(size_t rows, size_t cols, const Field& field);
+
+    // Решение для упакованных правых частей (rows_ x k), результат cols_ x k.
+    // Без inconsistent возвращает false при первой несовместной системе
+    bool solvePacked(const std::vector<uint64_t>& b, size_t k, std::vector<uint64_t>& x,
+                     std::vector<size_t>* inconsistent = nullptr) const;
+
+    size_t rows_;
+    size_t cols_;
+    const Field* field_;
+    ThreadPool* pool_ = nullptr;
+
+    // Множители на месте (rows_ x cols_, строки в порядке rowPerm_):
+    // строка i < r справа от ведущего столбца и в нём - строка U (единица
+    // на месте ведущего элемента), в ведущих столбцах pivots_[j], j < i, -
+    // элементы L[i][j]; диагональ L хранится в pivotValues_
+    std::vector<uint64_t> lu_;
+    std::vector<uint64_t> pivotValues_;
+    std::vector<size_t> pivots_;
+    std::vector<size_t> rowPerm_;
+    std::vector<size_t> colPerm_;
+};
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_PLUQ_HPP
@@ -0,0 +1,59 @@
+#ifndef MATRIX_GF2_REGION_OPS_HPP
+#define MATRIX_GF2_REGION_OPS_HPP
+
+#include "field.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace matrix_gf2 {
+
+/**
+ * @brief Операции над целыми строками (областями памяти) в GF(2^8) и GF(2^16)
+ *
+ * Элементы хранятся в упакованном виде (uint8_t / uint16_t, бит i -
+ * коэффициент при x^i), как в Field. Умножение на скаляр c выполняется
+ * по 4-битным таблицам: c * x = T_0[x & 15] ^ T_1[(x >> 4) & 15] ^ ...,
+ * а поиск в таблицах - байтовыми перестановками (PSHUFB) сразу для
+ * 16/32/64 байт. Набор инструкций (SSSE3, AVX2, AVX-512BW или скалярный
+ * код) выбирается один раз во время выполнения.
+ *
+ * Допускается dest == src (операция на месте).
+ */
+
+/**
+ * @brief dest[i] += c * src[i], i < n, в GF(2^8)
+ * @throws std::invalid_argument если поле не GF(2^8)
+ */
+void regionMultiplyAdd(const Field& field, uint8_t* dest, const uint8_t* src,
+                       uint8_t c, size_t n);
+
+/**
+ * @brief dest[i] = c * src[i], i < n, в GF(2^8)
+ * @throws std::invalid_argument если поле не GF(2^8)
+ */
+void regionMultiply(const Field& field, uint8_t* dest, const uint8_t* src,
+                    uint8_t c, size_t n);
+
+/**
+ * @brief dest[i] += c * src[i], i < n, в GF(2^16)
+ * @throws std::invalid_argument если поле не GF(2^16)
+ */
+void regionMultiplyAdd(const Field& field, uint16_t* dest, const uint16_t* src,
+                       uint16_t c, size_t n);
+
+/**
+ * @brief dest[i] = c * src[i], i < n, в GF(2^16)
+ * @throws std::invalid_argument если поле не GF(2^16)
+ */
+void regionMultiply(const Field& field, uint16_t* dest, const uint16_t* src,
+                    uint16_t c, size_t n);
+
+/**
+ * @brief Название используемого набора инструкций ("avx512bw", "avx2",
+ *        "ssse3" или "scalar")
+ */
+const char* regionKernelName();
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_REGION_OPS_HPP
@@ -0,0 +1,40 @@
+#ifndef MATRIX_GF2_SOLVE_HPP
+#define MATRIX_GF2_SOLVE_HPP
+
+#include "pluq.hpp"
+#include <vector>
+
+namespace matrix_gf2 {
+
+/**
+ * @brief Решение системы A * X = B с многими правыми частями
+ */
+struct SolveResult {
+    Matrix solution;                          // n x k: частные решения (свободные переменные - нули)
+    Matrix nullspace;                         // n x (n - r): базис ядра A
+    std::vector<size_t> inconsistentColumns;  // Столбцы B с несовместной системой (в solution - нули)
+    size_t rank = 0;
+
+    // Все системы совместны
+    bool consistent() const { return inconsistentColumns.empty(); }
+
+    // Constructor
+    SolveResult(const Matrix& x, const Matrix& n) : solution(x), nullspace(n) {}
+};
+
+/**
+ * @brief Решение A * X = B для всех столбцов B сразу
+ *
+ * A раскладывается один раз (PLUQ), после чего все правые части решаются
+ * блочными треугольными подстановками. Общее решение для совместного
+ * столбца t: solution[:, t] + nullspace * c для любого вектора c.
+ *
+ * @throws std::invalid_argument если число строк B не равно числу строк A
+ *         или матрицы заданы над разными полями
+ */
+SolveResult solve(const Matrix& a, const Matrix& b,
+                  const EliminationOptions& options = EliminationOptions());
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_SOLVE_HPP
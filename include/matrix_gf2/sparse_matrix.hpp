@@ -0,0 +1,120 @@
+#ifndef MATRIX_GF2_SPARSE_MATRIX_HPP
+#define MATRIX_GF2_SPARSE_MATRIX_HPP
+
+#include "matrix.hpp"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace matrix_gf2 {
+
+/**
+ * @brief Ненулевой элемент разреженной матрицы
+ */
+struct SparseEntry {
+    size_t row;
+    size_t col;
+    GFElement value;
+};
+
+/**
+ * @brief Разреженная матрица над GF(p^m) в формате CSR
+ *
+ * Хранятся только ненулевые элементы: для строки i - столбцы
+ * columnIndices()[rowPointers()[i] .. rowPointers()[i + 1]) в порядке
+ * возрастания и упакованные значения values() (GFElement::fromRaw).
+ * Формат CSC матрицы A - это CSR матрицы transpose().
+ *
+ * Ранг, решение систем и ядро вычисляются структурированным исключением:
+ * ведущий элемент выбирается по критерию Марковица (минимум
+ * (r_i - 1)(c_j - 1) среди нескольких самых коротких столбцов), чтобы
+ * заполнение оставалось малым. Когда плотность активной подматрицы
+ * достигает порога, она переносится в плотный массив и доисключается
+ * блочным методом (как forwardGauss(EliminationOptions)).
+ */
+class SparseMatrix {
+public:
+    /**
+     * @brief Конструктор нулевой матрицы
+     */
+    SparseMatrix(size_t rows, size_t cols, const Field& field);
+
+    /**
+     * @brief Конструктор из списка элементов (в любом порядке)
+     * @note Повторяющиеся позиции суммируются, нули отбрасываются
+     * @throws std::out_of_range если индекс вне границ матрицы
+     * @throws std::invalid_argument если элемент задан над другим полем
+     */
+    SparseMatrix(size_t rows, size_t cols, const Field& field,
+                 const std::vector<SparseEntry>& entries);
+
+    /**
+     * @brief Преобразование из плотной матрицы
+     */
+    static SparseMatrix fromMatrix(const Matrix& mat);
+
+    /**
+     * @brief Преобразование в плотную матрицу
+     */
+    Matrix toMatrix() const;
+
+    // Размеры, число ненулевых элементов и поле
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+    size_t nonZeros() const { return colIndex_.size(); }
+    const Field& field() const { return *field_; }
+
+    // Массивы CSR
+    const std::vector<size_t>& rowPointers() const { return rowPtr_; }
+    const std::vector<size_t>& columnIndices() const { return colIndex_; }
+    const std::vector<uint64_t>& values() const { return values_; }
+
+    // Доступ к элементу (с проверкой границ, двоичный поиск в строке)
+    GFElement get(size_t i, size_t j) const;
+
+    // Транспонирование (CSC исходной матрицы)
+    SparseMatrix transpose() const;
+
+    /**
+     * @brief Умножение на вектор-столбец
+     * @throws std::invalid_argument при несовпадении размера
+     */
+    std::vector<GFElement> operator*(const std::vector<GFElement>& vec) const;
+
+    /**
+     * @brief Вычисление ранга (широкая матрица исключается транспонированной)
+     * @param options Пул потоков для плотной части исключения
+     */
+    size_t rank(const EliminationOptions& options = EliminationOptions()) const;
+
+    /**
+     * @brief Решение системы A * x = b
+     * @return Частное решение (свободные переменные равны нулю) или
+     *         nullopt, если система несовместна
+     * @throws std::invalid_argument при несовпадении размера или поля
+     */
+    std::optional<std::vector<GFElement>> solve(
+        const std::vector<GFElement>& b,
+        const EliminationOptions& options = EliminationOptions()) const;
+
+    /**
+     * @brief Базис правого ядра: столбцы плотной матрицы n x (n - r), A * N = 0
+     */
+    Matrix nullspace(const EliminationOptions& options = EliminationOptions()) const;
+
+    // Операции сравнения
+    bool operator==(const SparseMatrix& other) const;
+    bool operator!=(const SparseMatrix& other) const;
+
+private:
+    size_t rows_;
+    size_t cols_;
+    const Field* field_;
+    std::vector<size_t> rowPtr_;
+    std::vector<size_t> colIndex_;
+    std::vector<uint64_t> values_;
+};
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_SPARSE_MATRIX_HPP
@@ -0,0 +1,374 @@
+#ifndef MATRIX_GF2_STATIC_FIELD_HPP
+#define MATRIX_GF2_STATIC_FIELD_HPP
+
+#include "gf_element.hpp"
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace matrix_gf2 {
+
+namespace detail {
+
+// Порядок поля P^M (0, если он больше 2^32)
+constexpr uint64_t staticFieldOrder(uint64_t p, uint32_t m) {
+    uint64_t order = 1;
+    for (uint32_t i = 0; i < m; ++i) {
+        if (order > (uint64_t(1) << 32) / p) {
+            return 0;
+        }
+        order *= p;
+    }
+    return order;
+}
+
+// Наименьший беззнаковый тип, вмещающий значения 0..order-1
+template <uint64_t Order>
+using StaticPackedType = std::conditional_t<(Order <= 0x100), uint8_t,
+                         std::conditional_t<(Order <= 0x10000), uint16_t, uint32_t>>;
+
+// Проверка, что Poly - нормированный полином степени m в системе счисления p
+constexpr bool isMonicModulus(uint64_t p, uint32_t m, uint64_t poly) {
+    for (uint32_t i = 0; i < m; ++i) {
+        poly /= p;
+    }
+    return poly == 1;
+}
+
+// Умножение полиномов по модулю Poly
+template <uint64_t P, uint32_t M, uint64_t Poly>
+constexpr uint64_t staticMulPoly(uint64_t a, uint64_t b) {
+    if constexpr (P == 2) {
+        // Схема Горнера по битам b: сдвиг, приведение, сложение
+        uint64_t result = 0;
+        for (uint32_t i = M; i-- > 0;) {
+            result <<= 1;
+            if ((result >> M) & 1) {
+                result ^= Poly;
+            }
+            if ((b >> i) & 1) {
+                result ^= a;
+            }
+        }
+        return result;
+    } else {
+        // При M >= 2 имеем P <= 2^16, поэтому суммы произведений помещаются в 64 бита
+        uint64_t da[M] = {}, db[M] = {}, mod[M + 1] = {};
+        uint64_t prod[2 * M - 1] = {};
+        uint64_t x = a, y = b, poly = Poly;
+        for (uint32_t i = 0; i < M; ++i) {
+            da[i] = x % P;
+            db[i] = y % P;
+            x /= P;
+            y /= P;
+        }
+        for (uint32_t i = 0; i <= M; ++i) {
+            mod[i] = poly % P;
+            poly /= P;
+        }
+        for (uint32_t i = 0; i < M; ++i) {
+            for (uint32_t j = 0; j < M; ++j) {
+                prod[i + j] += da[i] * db[j];
+            }
+        }
+        for (uint32_t deg = 2 * M - 2; deg >= M; --deg) {
+            uint64_t coeff = prod[deg] % P;
+            if (coeff != 0) {
+                // x^m = -(c_0 + ... + c_{m-1} x^{m-1})
+                for (uint32_t i = 0; i < M; ++i) {
+                    prod[deg - M + i] += coeff * (P - mod[i]);
+                }
+            }
+        }
+        uint64_t result = 0;
+        for (uint32_t i = M; i-- > 0;) {
+            result = result * P + prod[i] % P;
+        }
+        return result;
+    }
+}
+
+// Таблицы логарифмов GF(p^m), вычисляемые при компиляции
+template <uint64_t P, uint32_t M, uint64_t Poly, typename T, uint64_t Order>
+struct StaticLogTables {
+    // exp удвоена, чтобы не приводить сумму логарифмов по модулю q - 1
+    std::array<T, 2 * (Order - 1)> exp{};
+    std::array<uint32_t, Order> log{};
+    bool valid = false;
+
+    static constexpr StaticLogTables build() {
+        StaticLogTables tables;
+        // Поиск порождающего элемента мультипликативной группы, начиная с x
+        for (uint64_t g = P; g < Order && !tables.valid; ++g) {
+            uint64_t x = 1;
+            uint64_t order = 0;
+            do {
+                x = staticMulPoly<P, M, Poly>(x, g);
+                ++order;
+            } while (x != 1 && x != 0 && order < Order - 1);
+            if (x != 1 || order != Order - 1) {
+                continue;
+            }
+            x = 1;
+            for (uint64_t i = 0; i < Order - 1; ++i) {
+                tables.exp[i] = static_cast<T>(x);
+                tables.exp[i + Order - 1] = static_cast<T>(x);
+                tables.log[x] = static_cast<uint32_t>(i);
+                x = staticMulPoly<P, M, Poly>(x, g);
+            }
+            tables.valid = true;
+        }
+        return tables;
+    }
+
+    static constexpr StaticLogTables kInstance = build();
+};
+
+} // namespace detail
+
+/**
+ * @brief Элемент поля GF(p^m), параметры которого известны при компиляции
+ *
+ * Характеристика P, степень M и модуль Poly - параметры шаблона, поэтому
+ * компилятор подставляет и сворачивает приведение по модулю (деление на
+ * константу P, сдвиги и XOR с константным модулем для p = 2). Для полей
+ * порядка не больше kMaxStaticTableOrder таблицы логарифмов строятся
+ * во время компиляции (constexpr).
+ *
+ * Модуль Poly задаётся цифрами в системе счисления p, включая старший
+ * коэффициент: Poly = c_0 + c_1 p + ... + c_m p^m (для p = 2 это битовая
+ * маска, например 0x11D = x^8 + x^4 + x^3 + x^2 + 1). При M = 1 не
+ * используется. Упаковка значения совпадает с Field и GFElement.
+ *
+ * Порядок поля ограничен 2^32; большие поля доступны через Field.
+ */
+template <uint64_t P, uint32_t M = 1, uint64_t Poly = 0>
+class GF {
+public:
+    static constexpr uint64_t kOrder = detail::staticFieldOrder(P, M);
+
+    static_assert(P >= 2, "Характеристика поля должна быть >= 2");
+    static_assert(M >= 1, "Степень расширения должна быть >= 1");
+    static_assert(kOrder != 0, "Порядок поля должен быть не больше 2^32");
+    static_assert(M == 1 || detail::isMonicModulus(P, M, Poly),
+                  "Модуль должен быть нормированным полиномом степени M");
+
+    using value_type = detail::StaticPackedType<kOrder>;
+
+    static constexpr uint64_t kCharacteristic = P;
+    static constexpr uint32_t kDegree = M;
+    static constexpr uint64_t kModulus = Poly;
+
+    // Максимальный порядок поля с таблицами логарифмов, вычисляемыми при компиляции
+    static constexpr uint64_t kMaxStaticTableOrder = uint64_t(1) << 12;
+    static constexpr bool kHasTables = M > 1 && kOrder <= kMaxStaticTableOrder;
+
+    constexpr GF() : value_(0) {}
+
+    /**
+     * @brief Элемент по целочисленному значению (приводится по модулю p^m)
+     */
+    constexpr explicit GF(uint64_t value)
+        : value_(static_cast<value_type>(value % kOrder)) {}
+
+    /**
+     * @brief Элемент из упакованного значения без приведения
+     */
+    static constexpr GF fromRaw(value_type raw) {
+        GF result;
+        result.value_ = raw;
+        return result;
+    }
+
+    static constexpr GF zero() { return GF(); }
+    static constexpr GF one() { return fromRaw(1); }
+
+    constexpr value_type value() const { return value_; }
+
+    constexpr bool isZero() const { return value_ == 0; }
+    constexpr bool isOne() const { return value_ == 1; }
+
+    // Арифметические операции
+    constexpr GF operator+(GF other) const { return fromRaw(add(value_, other.value_)); }
+    constexpr GF operator-(GF other) const { return fromRaw(sub(value_, other.value_)); }
+    constexpr GF operator*(GF other) const { return fromRaw(mul(value_, other.value_)); }
+    constexpr GF operator/(GF other) const { return *this * other.inverse(); }
+    constexpr GF operator-() const { return fromRaw(sub(0, value_)); }
+
+    constexpr GF& operator+=(GF other) { return *this = *this + other; }
+    constexpr GF& operator-=(GF other) { return *this = *this - other; }
+    constexpr GF& operator*=(GF other) { return *this = *this * other; }
+    constexpr GF& operator/=(GF other) { return *this = *this / other; }
+
+    constexpr bool operator==(GF other) const { return value_ == other.value_; }
+    constexpr bool operator!=(GF other) const { return value_ != other.value_; }
+
+    /**
+     * @brief Обратный элемент
+     * @throws std::invalid_argument для нулевого элемента
+     */
+    constexpr GF inverse() const {
+        if (value_ == 0) {
+            throw std::invalid_argument("Ноль не имеет обратного элемента");
+        }
+        return fromRaw(inv(value_));
+    }
+
+    /**
+     * @brief Возведение в степень
+     */
+    constexpr GF pow(uint64_t exp) const { return fromRaw(powRaw(value_, exp)); }
+
+    /**
+     * @brief Коэффициенты модуля (начиная с младшего) для Field::get
+     */
+    static std::vector<uint32_t> modulusCoeffs() {
+        if (M == 1) {
+            return {1, 1};
+        }
+        std::vector<uint32_t> coeffs(M + 1);
+        uint64_t poly = Poly;
+        for (uint32_t i = 0; i <= M; ++i) {
+            coeffs[i] = static_cast<uint32_t>(poly % P);
+            poly /= P;
+        }
+        return coeffs;
+    }
+
+    /**
+     * @brief Соответствующий контекст поля времени выполнения
+     */
+    static const Field& field() {
+        static const Field& instance = Field::get(P, M, modulusCoeffs());
+        return instance;
+    }
+
+    /**
+     * @brief Преобразование в GFElement
+     */
+    GFElement toElement() const { return GFElement::fromRaw(field(), value_); }
+
+    /**
+     * @brief Преобразование из GFElement
+     * @throws std::invalid_argument если элемент принадлежит другому полю
+     */
+    static GF fromElement(const GFElement& elem) {
+        if (&elem.field() != &field()) {
+            throw std::invalid_argument("Элемент принадлежит другому полю");
+        }
+        return fromRaw(static_cast<value_type>(elem.raw()));
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, GF elem) {
+        return os << elem.toElement();
+    }
+
+    // Операции над упакованными значениями
+    static constexpr value_type add(value_type a, value_type b) {
+        if constexpr (P == 2) {
+            return static_cast<value_type>(a ^ b);
+        } else if constexpr (M == 1) {
+            uint64_t s = uint64_t(a) + b;
+            return static_cast<value_type>(s >= P ? s - P : s);
+        } else {
+            return combineDigits(a, b, false);
+        }
+    }
+
+    static constexpr value_type sub(value_type a, value_type b) {
+        if constexpr (P == 2) {
+            return static_cast<value_type>(a ^ b);
+        } else if constexpr (M == 1) {
+            return static_cast<value_type>(a >= b ? a - b : uint64_t(a) + P - b);
+        } else {
+            return combineDigits(a, b, true);
+        }
+    }
+
+    static constexpr value_type mul(value_type a, value_type b) {
+        if constexpr (M == 1) {
+            return static_cast<value_type>(uint64_t(a) * b % P);
+        } else if constexpr (kHasTables) {
+            if (a == 0 || b == 0) {
+                return 0;
+            }
+            return tables().exp[tables().log[a] + tables().log[b]];
+        } else {
+            return static_cast<value_type>(detail::staticMulPoly<P, M, Poly>(a, b));
+        }
+    }
+
+private:
+    value_type value_;
+
+    using LogTables = detail::StaticLogTables<P, M, Poly, value_type, kHasTables ? kOrder : 2>;
+
+    static constexpr const LogTables& tables() { return LogTables::kInstance; }
+
+    static_assert(!kHasTables || LogTables::kInstance.valid, "Модуль должен быть неприводимым");
+
+    // Покоэффициентное сложение/вычитание в GF(p^m), p нечетно
+    static constexpr value_type combineDigits(value_type a, value_type b, bool negate) {
+        uint64_t result = 0;
+        uint64_t base = 1;
+        uint64_t x = a, y = b;
+        for (uint32_t i = 0; i < M; ++i) {
+            uint64_t da = x % P, db = y % P;
+            x /= P;
+            y /= P;
+            uint64_t d = negate ? (da >= db ? da - db : da + P - db)
+                                : (da + db >= P ? da + db - P : da + db);
+            result += d * base;
+            base *= P;
+        }
+        return static_cast<value_type>(result);
+    }
+
+    static constexpr value_type powRaw(value_type a, uint64_t exp) {
+        value_type result = 1;
+        while (exp > 0) {
+            if (exp & 1) {
+                result = mul(result, a);
+            }
+            a = mul(a, a);
+            exp >>= 1;
+        }
+        return result;
+    }
+
+    static constexpr value_type inv(value_type a) {
+        if constexpr (M == 1) {
+            // Расширенный алгоритм Евклида
+            int64_t t = 0, newT = 1;
+            int64_t r = static_cast<int64_t>(P), newR = static_cast<int64_t>(a);
+            while (newR != 0) {
+                int64_t q = r / newR;
+                int64_t tmp = t - q * newT;
+                t = newT;
+                newT = tmp;
+                tmp = r - q * newR;
+                r = newR;
+                newR = tmp;
+            }
+            return static_cast<value_type>(t < 0 ? t + static_cast<int64_t>(P) : t);
+        } else if constexpr (kHasTables) {
+            return tables().exp[(kOrder - 1 - tables().log[a]) % (kOrder - 1)];
+        } else {
+            return powRaw(a, kOrder - 2);
+        }
+    }
+};
+
+// Поля, используемые на практике
+using GF2 = GF<2>;
+using GF3 = GF<3>;
+using GF256 = GF<2, 8, 0x11D>;        // x^8 + x^4 + x^3 + x^2 + 1
+using GF65536 = GF<2, 16, 0x1100B>;   // x^16 + x^12 + x^3 + x + 1
+using GF65521 = GF<65521>;
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_STATIC_FIELD_HPP
@@ -0,0 +1,467 @@
+#ifndef MATRIX_GF2_STATIC_MATRIX_HPP
+#define MATRIX_GF2_STATIC_MATRIX_HPP
+
+#include "aligned_allocator.hpp"
+#include "matrix.hpp"
+#include "region_ops.hpp"
+#include "static_field.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace matrix_gf2 {
+
+// Результат исключения Гаусса для матрицы над фиксированным полем
+template <typename F>
+struct StaticGaussResult;
+
+/**
+ * @brief Плотная матрица над полем F = GF<P, M, Poly>, известным при компиляции
+ *
+ * Элементы хранятся построчно в одном выровненном массиве упакованных
+ * значений, поэтому арифметика поля подставляется компилятором без
+ * проверок параметров поля. Для GF(2^8) и GF(2^16) строки обрабатываются
+ * SIMD-ядрами из region_ops.hpp.
+ */
+template <typename F>
+class StaticMatrix {
+public:
+    using value_type = typename F::value_type;
+
+    static_assert(sizeof(F) == sizeof(value_type),
+                  "Элемент поля должен совпадать по размеру с упакованным значением");
+
+    /**
+     * @brief Конструктор нулевой матрицы
+     * @param rows Количество строк
+     * @param cols Количество столбцов
+     */
+    StaticMatrix(size_t rows = 0, size_t cols = 0)
+        : rows_(rows), cols_(cols), data_(rows * cols) {}
+
+    /**
+     * @brief Конструктор из двумерного массива значений (приводятся по модулю p^m)
+     */
+    StaticMatrix(const std::vector<std::vector<uint32_t>>& data);
+
+    // Создание специальных матриц
+    static StaticMatrix identity(size_t n);
+    static StaticMatrix zero(size_t rows, size_t cols) { return StaticMatrix(rows, cols); }
+
+    /**
+     * @brief Преобразование из обычной матрицы
+     * @throws std::invalid_argument если матрица задана над другим полем
+     */
+    static StaticMatrix fromMatrix(const Matrix& mat);
+
+    /**
+     * @brief Преобразование в обычную матрицу
+     */
+    Matrix toMatrix() const;
+
+    // Размеры
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+
+    // Доступ к элементам (at - с проверкой границ)
+    F& operator()(size_t i, size_t j) { return data_[i * cols_ + j]; }
+    const F& operator()(size_t i, size_t j) const { return data_[i * cols_ + j]; }
+    F& at(size_t i, size_t j);
+    const F& at(size_t i, size_t j) const;
+
+    // Прямой доступ к строке
+    F* row(size_t i) { return data_.data() + i * cols_; }
+    const F* row(size_t i) const { return data_.data() + i * cols_; }
+
+    // Операции с матрицами
+    StaticMatrix operator+(const StaticMatrix& other) const;
+    StaticMatrix operator-(const StaticMatrix& other) const;
+    StaticMatrix operator*(const StaticMatrix& other) const;
+    StaticMatrix operator*(F scalar) const;
+
+    StaticMatrix& operator+=(const StaticMatrix& other);
+    StaticMatrix& operator-=(const StaticMatrix& other);
+
+    // Транспонирование
+    StaticMatrix transpose() const;
+
+    // Элементарные преобразования строк
+    void swapRows(size_t i, size_t j);
+    void multiplyRow(size_t i, F scalar);
+    void addRow(size_t dest, size_t src, F scalar);
+
+    /**
+     * @brief Прямой ход Гаусса (ступенчатый вид)
+     */
+    StaticGaussResult<F> forwardGauss() const;
+
+    /**
+     * @brief Полное исключение Гаусса-Жордана (RREF)
+     */
+    StaticGaussResult<F> reducedRowEchelonForm() const;
+
+    /**
+     * @brief Вычисление ранга матрицы
+     */
+    size_t rank() const;
+
+    /**
+     * @brief Проверка обратимости матрицы
+     */
+    bool isInvertible() const;
+
+    /**
+     * @brief Вычисление обратной матрицы
+     * @return Обратная матрица или nullopt, если матрица необратима
+     */
+    std::optional<StaticMatrix> inverse() const;
+
+    // Операции сравнения
+    bool operator==(const StaticMatrix& other) const {
+        return rows_ == other.rows_ && cols_ == other.cols_ && data_ == other.data_;
+    }
+    bool operator!=(const StaticMatrix& other) const { return !(*this == other); }
+
+    // Вывод
+    template <typename G>
+    friend std::ostream& operator<<(std::ostream& os, const StaticMatrix<G>& mat);
+
+private:
+    size_t rows_;
+    size_t cols_;
+    std::vector<F, AlignedAllocator<F>> data_;
+
+    // dest[k] += c * src[k], k < n
+    static void axpy(F* dest, const F* src, F c, size_t n);
+
+    // dest[k] = c * src[k], k < n
+    static void scale(F* dest, const F* src, F c, size_t n);
+
+    /**
+     * @brief Исключение Гаусса на месте
+     * @param backward Обнулять также элементы над ведущими (RREF)
+     * @param pivotCols Индексы ведущих столбцов
+     * @return Ранг матрицы
+     */
+    size_t eliminate(bool backward, std::vector<size_t>& pivotCols);
+};
+
+// Результат исключения Гаусса для матрицы над фиксированным полем
+template <typename F>
+struct StaticGaussResult {
+    StaticMatrix<F> matrix;
+    size_t rank = 0;
+    std::vector<size_t> pivotCols;
+
+    // Constructor
+    StaticGaussResult(const StaticMatrix<F>& m) : matrix(m), rank(0) {}
+};
+
+// Матрицы над полями, используемыми на практике
+using StaticMatrixGF2 = StaticMatrix<GF2>;
+using StaticMatrixGF3 = StaticMatrix<GF3>;
+using StaticMatrixGF256 = StaticMatrix<GF256>;
+using StaticMatrixGF65536 = StaticMatrix<GF65536>;
+using StaticMatrixGF65521 = StaticMatrix<GF65521>;
+
+// ---------------------------------------------------------------------------
+// Реализация
+// ---------------------------------------------------------------------------
+
+namespace detail {
+
+// Поля, строки над которыми обрабатываются ядрами region_ops.hpp
+template <typename F>
+constexpr bool hasRegionKernels() {
+    return F::kCharacteristic == 2 && (F::kDegree == 8 || F::kDegree == 16);
+}
+
+} // namespace detail
+
+template <typename F>
+StaticMatrix<F>::StaticMatrix(const std::vector<std::vector<uint32_t>>& data)
+    : rows_(data.size()), cols_(data.empty() ? 0 : data[0].size()),
+      data_(rows_ * cols_) {
+    for (size_t i = 0; i < rows_; ++i) {
+        for (size_t j = 0; j < cols_ && j < data[i].size(); ++j) {
+            (*this)(i, j) = F(data[i][j]);
+        }
+    }
+}
+
+template <typename F>
+StaticMatrix<F> StaticMatrix<F>::identity(size_t n) {
+    StaticMatrix result(n, n);
+    for (size_t i = 0; i < n; ++i) {
+        result(i, i) = F::one();
+    }
+    return result;
+}
+
+template <typename F>
+StaticMatrix<F> StaticMatrix<F>::fromMatrix(const Matrix& mat) {
+    if (&mat.field() != &F::field()) {
+        throw std::invalid_argument("Матрица задана над другим полем");
+    }
+    StaticMatrix result(mat.rows(), mat.cols());
+    for (size_t i = 0; i < mat.rows(); ++i) {
+        for (size_t j = 0; j < mat.cols(); ++j) {
+            result(i, j) = F::fromRaw(static_cast<value_type>(mat(i, j).raw()));
+        }
+    }
+    return result;
+}
+
+template <typename F>
+Matrix StaticMatrix<F>::toMatrix() const {
+    const Field& field = F::field();
+    Matrix result(rows_, cols_, field);
+    for (size_t i = 0; i < rows_; ++i) {
+        for (size_t j = 0; j < cols_; ++j) {
+            result(i, j) = GFElement::fromRaw(field, (*this)(i, j).value());
+        }
+    }
+    return result;
+}
+
+template <typename F>
+F& StaticMatrix<F>::at(size_t i, size_t j) {
+    if (i >= rows_ || j >= cols_) {
+        throw std::out_of_range("Индекс вне границ матрицы");
+    }
+    return (*this)(i, j);
+}
+
+template <typename F>
+const F& StaticMatrix<F>::at(size_t i, size_t j) const {
+    if (i >= rows_ || j >= cols_) {
+        throw std::out_of_range("Индекс вне границ матрицы");
+    }
+    return (*this)(i, j);
+}
+
+template <typename F>
+void StaticMatrix<F>::axpy(F* dest, const F* src, F c, size_t n) {
+    if constexpr (detail::hasRegionKernels<F>()) {
+        regionMultiplyAdd(F::field(), reinterpret_cast<value_type*>(dest),
+                          reinterpret_cast<const value_type*>(src), c.value(), n);
+    } else {
+        for (size_t k = 0; k < n; ++k) {
+            dest[k] += c * src[k];
+        }
+    }
+}
+
+template <typename F>
+void StaticMatrix<F>::scale(F* dest, const F* src, F c, size_t n) {
+    if constexpr (detail::hasRegionKernels<F>()) {
+        regionMultiply(F::field(), reinterpret_cast<value_type*>(dest),
+                       reinterpret_cast<const value_type*>(src), c.value(), n);
+    } else {
+        for (size_t k = 0; k < n; ++k) {
+            dest[k] = c * src[k];
+        }
+    }
+}
+
+template <typename F>
+StaticMatrix<F> StaticMatrix<F>::operator+(const StaticMatrix& other) const {
+    StaticMatrix result(*this);
+    result += other;
+    return result;
+}
+
+template <typename F>
+StaticMatrix<F> StaticMatrix<F>::operator-(const StaticMatrix& other) const {
+    StaticMatrix result(*this);
+    result -= other;
+    return result;
+}
+
+template <typename F>
+StaticMatrix<F>& StaticMatrix<F>::operator+=(const StaticMatrix& other) {
+    if (rows_ != other.rows_ || cols_ != other.cols_) {
+        throw std::invalid_argument("Размеры матриц не совпадают");
+    }
+    for (size_t k = 0; k < data_.size(); ++k) {
+        data_[k] += other.data_[k];
+    }
+    return *this;
+}
+
+template <typename F>
+StaticMatrix<F>& StaticMatrix<F>::operator-=(const StaticMatrix& other) {
+    if (rows_ != other.rows_ || cols_ != other.cols_) {
+        throw std::invalid_argument("Размеры матриц не совпадают");
+    }
+    for (size_t k = 0; k < data_.size(); ++k) {
+        data_[k] -= other.data_[k];
+    }
+    return *this;
+}
+
+template <typename F>
+StaticMatrix<F> StaticMatrix<F>::operator*(const StaticMatrix& other) const {
+    if (cols_ != other.rows_) {
+        throw std::invalid_argument("Несовместимые размеры для умножения матриц");
+    }
+    // Порядок i-k-j: строка результата накапливается как сумма строк other
+    StaticMatrix result(rows_, other.cols_);
+    for (size_t i = 0; i < rows_; ++i) {
+        for (size_t k = 0; k < cols_; ++k) {
+            F a = (*this)(i, k);
+            if (!a.isZero()) {
+                axpy(result.row(i), other.row(k), a, other.cols_);
+            }
+        }
+    }
+    return result;
+}
+
+template <typename F>
+StaticMatrix<F> StaticMatrix<F>::operator*(F scalar) const {
+    StaticMatrix result(rows_, cols_);
+    scale(result.data_.data(), data_.data(), scalar, data_.size());
+    return result;
+}
+
+template <typename F>
+StaticMatrix<F> StaticMatrix<F>::transpose() const {
+    StaticMatrix result(cols_, rows_);
+    for (size_t i = 0; i < rows_; ++i) {
+        for (size_t j = 0; j < cols_; ++j) {
+            result(j, i) = (*this)(i, j);
+        }
+    }
+    return result;
+}
+
+template <typename F>
+void StaticMatrix<F>::swapRows(size_t i, size_t j) {
+    if (i >= rows_ || j >= rows_) {
+        throw std::out_of_range("Индекс строки вне границ");
+    }
+    if (i != j) {
+        std::swap_ranges(row(i), row(i) + cols_, row(j));
+    }
+}
+
+template <typename F>
+void StaticMatrix<F>::multiplyRow(size_t i, F scalar) {
+    if (i >= rows_) {
+        throw std::out_of_range("Индекс строки вне границ");
+    }
+    scale(row(i), row(i), scalar, cols_);
+}
+
+template <typename F>
+void StaticMatrix<F>::addRow(size_t dest, size_t src, F scalar) {
+    if (dest >= rows_ || src >= rows_) {
+        throw std::out_of_range("Индекс строки вне границ");
+    }
+    axpy(row(dest), row(src), scalar, cols_);
+}
+
+template <typename F>
+size_t StaticMatrix<F>::eliminate(bool backward, std::vector<size_t>& pivotCols) {
+    pivotCols.clear();
+    size_t rank = 0;
+    for (size_t col = 0; col < cols_ && rank < rows_; ++col) {
+        size_t pivot = rank;
+        while (pivot < rows_ && (*this)(pivot, col).isZero()) {
+            ++pivot;
+        }
+        if (pivot == rows_) {
+            continue;
+        }
+        swapRows(rank, pivot);
+
+        // Нормализация ведущей строки (начиная с ведущего столбца)
+        F inv = (*this)(rank, col).inverse();
+        scale(row(rank) + col, row(rank) + col, inv, cols_ - col);
+
+        size_t start = backward ? 0 : rank + 1;
+        for (size_t i = start; i < rows_; ++i) {
+            F factor = (*this)(i, col);
+            if (i != rank && !factor.isZero()) {
+                axpy(row(i) + col, row(rank) + col, -factor, cols_ - col);
+            }
+        }
+        pivotCols.push_back(col);
+        ++rank;
+    }
+    return rank;
+}
+
+template <typename F>
+StaticGaussResult<F> StaticMatrix<F>::forwardGauss() const {
+    StaticGaussResult<F> result(*this);
+    result.rank = result.matrix.eliminate(false, result.pivotCols);
+    return result;
+}
+
+template <typename F>
+StaticGaussResult<F> StaticMatrix<F>::reducedRowEchelonForm() const {
+    StaticGaussResult<F> result(*this);
+    result.rank = result.matrix.eliminate(true, result.pivotCols);
+    return result;
+}
+
+template <typename F>
+size_t StaticMatrix<F>::rank() const {
+    return forwardGauss().rank;
+}
+
+template <typename F>
+bool StaticMatrix<F>::isInvertible() const {
+    return rows_ == cols_ && rank() == rows_;
+}
+
+template <typename F>
+std::optional<StaticMatrix<F>> StaticMatrix<F>::inverse() const {
+    if (rows_ != cols_) {
+        return std::nullopt;
+    }
+
+    // Расширенная матрица [A | I]
+    size_t n = rows_;
+    StaticMatrix augmented(n, 2 * n);
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(row(i), row(i) + n, augmented.row(i));
+        augmented(i, n + i) = F::one();
+    }
+
+    std::vector<size_t> pivotCols;
+    if (augmented.eliminate(true, pivotCols) < n || (n > 0 && pivotCols.back() >= n)) {
+        return std::nullopt;
+    }
+
+    StaticMatrix result(n, n);
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(augmented.row(i) + n, augmented.row(i) + 2 * n, result.row(i));
+    }
+    return result;
+}
+
+template <typename F>
+std::ostream& operator<<(std::ostream& os, const StaticMatrix<F>& mat) {
+    for (size_t i = 0; i < mat.rows(); ++i) {
+        os << "[";
+        for (size_t j = 0; j < mat.cols(); ++j) {
+            if (j > 0) os << " ";
+            os << std::setw(4) << mat(i, j);
+        }
+        os << " ]";
+        if (i < mat.rows() - 1) os << "\n";
+    }
+    return os;
+}
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_STATIC_MATRIX_HPP
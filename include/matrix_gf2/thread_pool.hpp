@@ -0,0 +1,74 @@
+#ifndef MATRIX_GF2_THREAD_POOL_HPP
+#define MATRIX_GF2_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace matrix_gf2 {
+
+/**
+ * @brief Пул потоков для параллельных операций над матрицами
+ *
+ * Размер пула - общее число потоков, выполняющих работу: вызывающий поток
+ * тоже участвует, поэтому запускается size() - 1 рабочих потоков, а пул
+ * размера 1 выполняет всё последовательно. Вызывающий поток сам забирает
+ * задачи своего parallelFor, так что вложенные вызовы не блокируются,
+ * даже если все рабочие потоки заняты.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Пул из threads потоков (0 - std::thread::hardware_concurrency())
+     */
+    explicit ThreadPool(size_t threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Число потоков, включая вызывающий
+     */
+    size_t size() const { return workers_.size() + 1; }
+
+    /**
+     * @brief Выполнить task(i) для всех i < count и дождаться завершения
+     *
+     * Индексы раздаются потокам динамически. Первое исключение из задач
+     * пробрасывается в вызывающий поток после завершения остальных.
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)>& task);
+
+    /**
+     * @brief Общий пул библиотеки (создаётся при первом обращении)
+     */
+    static ThreadPool& global();
+
+    /**
+     * @brief Задать размер общего пула до первого обращения к global()
+     * @throws std::runtime_error если общий пул уже создан
+     */
+    static void setGlobalSize(size_t threads);
+
+private:
+    struct Job;
+
+    void workerLoop();
+    static void runJob(Job& job);
+
+    std::vector<std::thread> workers_;
+    std::deque<std::shared_ptr<Job>> queue_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_THREAD_POOL_HPP
@@ -0,0 +1,54 @@
+#ifndef MATRIX_GF2_WIDE_ARITH_HPP
+#define MATRIX_GF2_WIDE_ARITH_HPP
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace matrix_gf2 {
+namespace detail {
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+/**
+ * @brief Полное 128-битное произведение двух 64-битных чисел
+ * @param hi Старшие 64 бита
+ * @param lo Младшие 64 бита
+ */
+inline void mulWide(uint64_t a, uint64_t b, uint64_t& hi, uint64_t& lo) {
+#if defined(__SIZEOF_INT128__)
+    uint128_t t = static_cast<uint128_t>(a) * b;
+    hi = static_cast<uint64_t>(t >> 64);
+    lo = static_cast<uint64_t>(t);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    lo = _umul128(a, b, &hi);
+#else
+    uint64_t aLo = a & 0xFFFFFFFFu, aHi = a >> 32;
+    uint64_t bLo = b & 0xFFFFFFFFu, bHi = b >> 32;
+    uint64_t ll = aLo * bLo;
+    uint64_t lh = aLo * bHi;
+    uint64_t hl = aHi * bLo;
+    uint64_t hh = aHi * bHi;
+    uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+    lo = (mid << 32) | (ll & 0xFFFFFFFFu);
+    hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/**
+ * @brief Старшие 64 бита произведения
+ */
+inline uint64_t mulHigh(uint64_t a, uint64_t b) {
+    uint64_t hi, lo;
+    mulWide(a, b, hi, lo);
+    return hi;
+}
+
+} // namespace detail
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_WIDE_ARITH_HPP
@@ -0,0 +1,51 @@
+#ifndef MATRIX_GF2_WIEDEMANN_HPP
+#define MATRIX_GF2_WIEDEMANN_HPP
+
+#include "sparse_matrix.hpp"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace matrix_gf2 {
+
+/**
+ * @brief Параметры итеративного решателя Видемана
+ */
+struct WiedemannOptions {
+    ThreadPool* pool = nullptr;  // Пул для умножений на матрицу (nullptr - общий)
+    size_t maxProjections = 64;  // Число случайных проекций до отказа
+    uint64_t seed = 0;           // Начальное значение генератора (0 - случайное)
+};
+
+/**
+ * @brief Решение A * x = b методом Видемана для квадратной разреженной A
+ *
+ * Матрица используется только как «чёрный ящик» умножения на вектор,
+ * поэтому память - O(nnz + n) без заполнения. Для случайной проекции u
+ * по последовательности u^T A^i b (2n членов) алгоритмом Берлекэмпа-Мэсси
+ * находится её минимальный многочлен f; если f(0) != 0, то
+ * x = -(f(A) - f(0)) / (f(0) A) * b. Если проекция дала лишь делитель
+ * минимального многочлена, решение уточняется по невязке со следующей
+ * проекцией, так что суммарное число умножений - O(n) на раунд.
+ * Умножения выполняются параллельно по строкам в пуле потоков.
+ *
+ * @return Решение или nullopt, если A вырождена (f(0) = 0) или решение
+ *         не найдено за maxProjections проекций
+ * @throws std::invalid_argument если A не квадратная, размер b не совпадает
+ *         или b задан над другим полем
+ */
+std::optional<std::vector<GFElement>> wiedemannSolve(
+    const SparseMatrix& a, const std::vector<GFElement>& b,
+    const WiedemannOptions& options = WiedemannOptions());
+
+/**
+ * @brief Минимальный многочлен линейно рекуррентной последовательности
+ *        (алгоритм Берлекэмпа-Мэсси)
+ * @param sequence Члены s_0, s_1, ... над полем
+ * @return Коэффициенты c_0, ..., c_L (c_L = 1): sum c_j s_{i+j} = 0 для всех i
+ */
+std::vector<GFElement> berlekampMassey(const std::vector<GFElement>& sequence);
+
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_WIEDEMANN_HPP
@@ -0,0 +1,149 @@
+#include "../include/matrix_gf2/binary_field.hpp"
+#include <iomanip>
+#include <stdexcept>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define MATRIX_GF2_CLMUL_DISPATCH 1
+#endif
+
+namespace matrix_gf2 {
+
+namespace detail {
+
+namespace {
+
+// Переносимое безпереносное умножение: окна по 4 бита множителя b
+void clmulPortable(uint64_t a, uint64_t b, uint64_t& hi, uint64_t& lo) {
+    // table[i] = a * i (до 67 бит: младшее слово и 3 старших бита)
+    uint64_t tableLo[16];
+    uint64_t tableHi[16];
+    tableLo[0] = 0;
+    tableHi[0] = 0;
+    for (unsigned i = 1; i < 16; ++i) {
+        if (i % 2 == 0) {
+            tableLo[i] = tableLo[i / 2] << 1;
+            tableHi[i] = (tableHi[i / 2] << 1) | (tableLo[i / 2] >> 63);
+        } else {
+            tableLo[i] = tableLo[i - 1] ^ a;
+            tableHi[i] = tableHi[i - 1];
+        }
+    }
+
+    hi = 0;
+    lo = 0;
+    for (int shift = 60; shift >= 0; shift -= 4) {
+        hi = (hi << 4) | (lo >> 60);
+        lo <<= 4;
+        unsigned idx = static_cast<unsigned>((b >> shift) & 15);
+        lo ^= tableLo[idx];
+        hi ^= tableHi[idx];
+    }
+}
+
+#if defined(MATRIX_GF2_CLMUL_DISPATCH)
+__attribute__((target("pclmul,sse2")))
+void clmulHardware(uint64_t a, uint64_t b, uint64_t& hi, uint64_t& lo) {
+    __m128i va = _mm_cvtsi64_si128(static_cast<long long>(a));
+    __m128i vb = _mm_cvtsi64_si128(static_cast<long long>(b));
+    __m128i r = _mm_clmulepi64_si128(va, vb, 0x00);
+    lo = static_cast<uint64_t>(_mm_cvtsi128_si64(r));
+    hi = static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(r, r)));
+}
+#endif
+
+} // namespace
+
+bool hasHardwareClmul() {
+#if defined(MATRIX_GF2_CLMUL_DISPATCH)
+    static const bool supported = __builtin_cpu_supports("pclmul");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+void clmul64(uint64_t a, uint64_t b, uint64_t& hi, uint64_t& lo) {
+#if defined(MATRIX_GF2_CLMUL_DISPATCH)
+    if (hasHardwareClmul()) {
+        clmulHardware(a, b, hi, lo);
+        return;
+    }
+#endif
+    clmulPortable(a, b, hi, lo);
+}
+
+uint64_t clmulReduce(uint64_t hi, uint64_t lo, uint32_t m, uint64_t r) {
+    const uint64_t mask = m == 64 ? ~uint64_t(0) : (uint64_t(1) << m) - 1;
+    for (;;) {
+        // P = H * x^m + L, а x^m = r (mod модуля), поэтому P = H * r + L
+        uint64_t high = m == 64 ? hi : (hi << (64 - m)) | (lo >> m);
+        uint64_t low = lo & mask;
+        if (high == 0) {
+            return low;
+        }
+        clmul64(high, r, hi, lo);
+        lo ^= low;
+    }
+}
+
+} // namespace detail
+
+GF2_128 GF2_128::mul(const GF2_128& a, const GF2_128& b, uint64_t r) {
+    // Карацуба: три умножения 64 x 64
+    uint64_t z0Hi, z0Lo, z1Hi, z1Lo, z2Hi, z2Lo;
+    detail::clmul64(a.lo_, b.lo_, z0Hi, z0Lo);
+    detail::clmul64(a.hi_, b.hi_, z2Hi, z2Lo);
+    detail::clmul64(a.lo_ ^ a.hi_, b.lo_ ^ b.hi_, z1Hi, z1Lo);
+    z1Hi ^= z0Hi ^ z2Hi;
+    z1Lo ^= z0Lo ^ z2Lo;
+
+    // Произведение из 256 бит: p3 p2 p1 p0
+    uint64_t p0 = z0Lo;
+    uint64_t p1 = z0Hi ^ z1Lo;
+    uint64_t p2 = z2Lo ^ z1Hi;
+    uint64_t p3 = z2Hi;
+
+    // Первая свертка: (p3 p2) * r
+    uint64_t tHi, tLo, uHi, uLo;
+    detail::clmul64(p2, r, tHi, tLo);
+    detail::clmul64(p3, r, uHi, uLo);
+    p0 ^= tLo;
+    p1 ^= tHi ^ uLo;
+
+    // Вторая свертка: остаток uHi имеет степень < 63
+    uint64_t vHi, vLo;
+    detail::clmul64(uHi, r, vHi, vLo);
+    p0 ^= vLo;
+    p1 ^= vHi;
+
+    return GF2_128(p0, p1);
+}
+
+GF2_128 GF2_128::inverse() const {
+    if (isZero()) {
+        throw std::invalid_argument("Ноль не имеет обратного элемента");
+    }
+
+    // a^(-1) = a^(2^128 - 2): в показателе установлены биты 1..127
+    GF2_128 result(1, 0);
+    for (int bit = 127; bit >= 0; --bit) {
+        result = result * result;
+        if (bit != 0) {
+            result = result * (*this);
+        }
+    }
+    return result;
+}
+
+std::ostream& operator<<(std::ostream& os, const GF2_128& elem) {
+    std::ios_base::fmtflags flags = os.flags();
+    char fill = os.fill('0');
+    os << "0x" << std::hex << std::setw(16) << elem.hi_
+       << std::setw(16) << elem.lo_;
+    os.fill(fill);
+    os.flags(flags);
+    return os;
+}
+
+} // namespace matrix_gf2
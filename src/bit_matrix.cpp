@@ -0,0 +1,499 @@
+#include "../include/matrix_gf2/bit_matrix.hpp"
+#include "bit_ops.hpp"
+#include <iomanip>
+#include <random>
+#include <stdexcept>
+#include <algorithm>
+
+namespace matrix_gf2 {
+
+namespace {
+
+// Количество слов uint64_t в одной кэш-линии
+constexpr size_t kWordsPerLine = 64 / sizeof(uint64_t);
+
+size_t wordsFor(size_t cols) {
+    return (cols + 63) / 64;
+}
+
+size_t strideFor(size_t words) {
+    return (words + kWordsPerLine - 1) / kWordsPerLine * kWordsPerLine;
+}
+
+// Маска значащих битов последнего слова строки
+uint64_t lastWordMask(size_t cols) {
+    size_t tail = cols % 64;
+    return tail == 0 ? ~uint64_t(0) : (uint64_t(1) << tail) - 1;
+}
+
+inline void xorWords(uint64_t* dest, const uint64_t* src, size_t count) {
+    for (size_t w = 0; w < count; ++w) {
+        dest[w] ^= src[w];
+    }
+}
+
+// Метод четырёх русских (M4RM): одно слово строки A (64 строки B) за проход
+// обрабатывается восемью таблицами по 8 бит; столбцы B и C разбиваются на
+// блоки по kM4RMBlockWords слов, чтобы таблицы (1 МиБ) помещались в кэш L2
+constexpr size_t kM4RMTables = 8;
+constexpr size_t kM4RMTableSize = 256;
+constexpr size_t kM4RMBlockWords = 64;
+
+// Меньшие матрицы умножаются построчным XOR: построение таблиц не окупается
+constexpr size_t kM4RMMinRows = 128;
+
+// Наибольшее число ведущих элементов в блоке M4RI (таблица из 2^k строк)
+constexpr size_t kM4RIMaxPivots = 8;
+
+/**
+ * @brief Таблица всех 256 линейных комбинаций строк b[firstRow..firstRow+7]
+ *
+ * Комбинации перебираются в порядке кода Грея, поэтому каждая следующая
+ * получается из предыдущей одним XOR строки. Берутся слова
+ * [offset, offset + width) строк; отсутствующие строки считаются нулевыми.
+ */
+void buildGrayTable(uint64_t* table, const BitMatrix& b, size_t firstRow,
+                    size_t offset, size_t width) {
+    std::fill(table, table + width, uint64_t(0));
+    for (size_t i = 1; i < kM4RMTableSize; ++i) {
+        size_t gray = i ^ (i >> 1);
+        size_t prevGray = (i - 1) ^ ((i - 1) >> 1);
+        size_t r = firstRow + detail::countTrailingZeros(i);
+        uint64_t* dest = table + gray * width;
+        const uint64_t* prev = table + prevGray * width;
+        if (r < b.rows()) {
+            const uint64_t* src = b.row(r) + offset;
+            for (size_t w = 0; w < width; ++w) {
+                dest[w] = prev[w] ^ src[w];
+            }
+        } else {
+            std::copy(prev, prev + width, dest);
+        }
+    }
+}
+
+void multiplyM4RM(BitMatrix& c, const BitMatrix& a, const BitMatrix& b) {
+    std::vector<uint64_t, AlignedAllocator<uint64_t>> tables(
+        kM4RMTables * kM4RMTableSize * kM4RMBlockWords);
+    for (size_t offset = 0; offset < b.words(); offset += kM4RMBlockWords) {
+        size_t width = std::min(kM4RMBlockWords, b.words() - offset);
+        for (size_t w = 0; w < a.words(); ++w) {
+            size_t tableCount = 0;
+            for (; tableCount < kM4RMTables; ++tableCount) {
+                size_t firstRow = w * 64 + tableCount * 8;
+                if (firstRow >= b.rows()) {
+                    break;
+                }
+                buildGrayTable(tables.data() + tableCount * kM4RMTableSize * width,
+                               b, firstRow, offset, width);
+            }
+
+            for (size_t i = 0; i < a.rows(); ++i) {
+                uint64_t bits = a.row(i)[w];
+                if (bits == 0) {
+                    continue;
+                }
+                // Строка 0 каждой таблицы нулевая, поэтому восемь слагаемых
+                // складываются без ветвлений (недостроенные таблицы заменяются
+                // нулевой строкой последней построенной)
+                const uint64_t* rows[kM4RMTables];
+                for (size_t t = 0; t < kM4RMTables; ++t) {
+                    size_t index = t < tableCount ? (bits >> (8 * t)) & (kM4RMTableSize - 1) : 0;
+                    rows[t] = tables.data() + (std::min(t, tableCount - 1) * kM4RMTableSize + index) * width;
+                }
+                uint64_t* dest = c.row(i) + offset;
+                for (size_t j = 0; j < width; ++j) {
+                    dest[j] ^= rows[0][j] ^ rows[1][j] ^ rows[2][j] ^ rows[3][j] ^
+                               rows[4][j] ^ rows[5][j] ^ rows[6][j] ^ rows[7][j];
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+BitMatrix::BitMatrix(size_t rows, size_t cols)
+    : rows_(rows), cols_(cols), words_(wordsFor(cols)),
+      stride_(strideFor(words_)), data_(rows * stride_, 0) {}
+
+BitMatrix::BitMatrix(const std::vector<std::vector<uint32_t>>& data)
+    : BitMatrix(data.size(), data.empty() ? 0 : data[0].size()) {
+    for (size_t i = 0; i < rows_; ++i) {
+        for (size_t j = 0; j < cols_ && j < data[i].size(); ++j) {
+            if (data[i][j] % 2 != 0) {
+                row(i)[j / 64] |= uint64_t(1) << (j % 64);
+            }
+        }
+    }
+}
+
+BitMatrix BitMatrix::identity(size_t n) {
+    BitMatrix result(n, n);
+    for (size_t i = 0; i < n; ++i) {
+        result.row(i)[i / 64] |= uint64_t(1) << (i % 64);
+    }
+    return result;
+}
+
+BitMatrix BitMatrix::zero(size_t rows, size_t cols) {
+    return BitMatrix(rows, cols);
+}
+
+BitMatrix BitMatrix::random(size_t rows, size_t cols) {
+    BitMatrix result(rows, cols);
+    std::random_device rd;
+    std::mt19937_64 gen(rd());
+
+    for (size_t i = 0; i < rows; ++i) {
+        uint64_t* r = result.row(i);
+        for (size_t w = 0; w < result.words_; ++w) {
+            r[w] = gen();
+        }
+        if (result.words_ > 0) {
+            r[result.words_ - 1] &= lastWordMask(cols);
+        }
+    }
+    return result;
+}
+
+BitMatrix BitMatrix::fromMatrix(const ConstMatrixView& mat) {
+    if (mat.field().p() != 2 || mat.field().m() != 1) {
+        throw std::invalid_argument("Матрица должна быть задана над GF(2)");
+    }
+
+    BitMatrix result(mat.rows(), mat.cols());
+    if (mat.isTransposed()) {
+        // Строка исходной матрицы - столбец j результата
+        for (size_t j = 0; j < mat.cols(); ++j) {
+            const GFElement* src = mat.rowData(j);
+            for (size_t i = 0; i < mat.rows(); ++i) {
+                if (src[i].raw() != 0) {
+                    result.row(i)[j / 64] |= uint64_t(1) << (j % 64);
+                }
+            }
+        }
+        return result;
+    }
+    for (size_t i = 0; i < mat.rows(); ++i) {
+        uint64_t* r = result.row(i);
+        const GFElement* src = mat.rowData(i);
+        for (size_t j = 0; j < mat.cols(); ++j) {
+            if (src[j].raw() != 0) {
+                r[j / 64] |= uint64_t(1) << (j % 64);
+            }
+        }
+    }
+    return result;
+}
+
+Matrix BitMatrix::toMatrix() const {
+    Matrix result(rows_, cols_, 2, 1);
+    GFElement one(1, 2, 1);
+    for (size_t i = 0; i < rows_; ++i) {
+        const uint64_t* r = row(i);
+        GFElement* dest = result.rowData(i);
+        for (size_t w = 0; w < words_; ++w) {
+            uint64_t bits = r[w];
+            while (bits != 0) {
+                size_t j = w * 64 + detail::countTrailingZeros(bits);
+                dest[j] = one;
+                bits &= bits - 1;
+            }
+        }
+    }
+    return result;
+}
+
+bool BitMatrix::get(size_t i, size_t j) const {
+    if (i >= rows_ || j >= cols_) {
+        throw std::out_of_range("Индекс вне границ матрицы");
+    }
+    return (row(i)[j / 64] >> (j % 64)) & 1;
+}
+
+void BitMatrix::set(size_t i, size_t j, bool value) {
+    if (i >= rows_ || j >= cols_) {
+        throw std::out_of_range("Индекс вне границ матрицы");
+    }
+    uint64_t mask = uint64_t(1) << (j % 64);
+    if (value) {
+        row(i)[j / 64] |= mask;
+    } else {
+        row(i)[j / 64] &= ~mask;
+    }
+}
+
+BitMatrix BitMatrix::operator+(const BitMatrix& other) const {
+    BitMatrix result = *this;
+    result += other;
+    return result;
+}
+
+BitMatrix& BitMatrix::operator+=(const BitMatrix& other) {
+    if (rows_ != other.rows_ || cols_ != other.cols_) {
+        throw std::invalid_argument("Размеры матриц не совпадают");
+    }
+    xorWords(data_.data(), other.data_.data(), data_.size());
+    return *this;
+}
+
+BitMatrix BitMatrix::operator*(const BitMatrix& other) const {
+    if (cols_ != other.rows_) {
+        throw std::invalid_argument("Несовместимые размеры для умножения матриц");
+    }
+
+    BitMatrix result(rows_, other.cols_);
+    if (rows_ >= kM4RMMinRows) {
+        multiplyM4RM(result, *this, other);
+        return result;
+    }
+
+    // Строка i результата - XOR тех строк other, которым соответствуют
+    // единицы в строке i текущей матрицы
+    for (size_t i = 0; i < rows_; ++i) {
+        const uint64_t* a = row(i);
+        uint64_t* c = result.row(i);
+        for (size_t w = 0; w < words_; ++w) {
+            uint64_t bits = a[w];
+            while (bits != 0) {
+                size_t k = w * 64 + detail::countTrailingZeros(bits);
+                xorWords(c, other.row(k), other.words_);
+                bits &= bits - 1;
+            }
+        }
+    }
+    return result;
+}
+
+BitMatrix BitMatrix::transpose() const {
+    BitMatrix result(cols_, rows_);
+    for (size_t i = 0; i < rows_; ++i) {
+        const uint64_t* r = row(i);
+        for (size_t w = 0; w < words_; ++w) {
+            uint64_t bits = r[w];
+            while (bits != 0) {
+                size_t j = w * 64 + detail::countTrailingZeros(bits);
+                result.row(j)[i / 64] |= uint64_t(1) << (i % 64);
+                bits &= bits - 1;
+            }
+        }
+    }
+    return result;
+}
+
+void BitMatrix::swapRows(size_t i, size_t j) {
+    if (i >= rows_ || j >= rows_) {
+        throw std::out_of_range("Индекс строки вне границ");
+    }
+    if (i != j) {
+        std::swap_ranges(row(i), row(i) + words_, row(j));
+    }
+}
+
+void BitMatrix::addRow(size_t dest, size_t src) {
+    if (dest >= rows_ || src >= rows_) {
+        throw std::out_of_range("Индекс строки вне границ");
+    }
+    xorWords(row(dest), row(src), words_);
+}
+
+size_t BitMatrix::eliminate(bool backward, std::vector<size_t>& pivotCols) {
+    // Метод четырёх русских (M4RI): за один блок ищется до k ведущих
+    // элементов, затем строится таблица всех 2^k комбинаций ведущих строк,
+    // и каждая из остальных строк очищается одним поиском в таблице и XOR.
+    // Результат совпадает с классическим исключением: ведущие строки
+    // выбираются в том же порядке, а комбинация ведущих строк, обнуляющая
+    // ведущие столбцы, единственна.
+    size_t currentRow = 0;
+    size_t col = 0;
+    std::vector<size_t> reduced(rows_, 0);  // Число учтённых ведущих строк блока
+    std::vector<uint64_t, AlignedAllocator<uint64_t>> table;
+
+    while (col < cols_ && currentRow < rows_) {
+        size_t remaining = rows_ - currentRow;
+        size_t k = 1;
+        while (k < kM4RIMaxPivots && (size_t(4) << (k + 1)) <= remaining) {
+            ++k;
+        }
+
+        // Поиск до k ведущих элементов; строки приводятся по ведущим
+        // строкам блока лениво, только когда до них доходит поиск
+        std::vector<size_t> blockCols;
+        size_t firstWord = col / 64;
+        size_t tailWords = words_ - firstWord;
+        std::fill(reduced.begin() + currentRow, reduced.end(), size_t(0));
+        for (; col < cols_ && blockCols.size() < k && currentRow + blockCols.size() < rows_; ++col) {
+            size_t word = col / 64;
+            uint64_t mask = uint64_t(1) << (col % 64);
+            size_t pivotRow = currentRow + blockCols.size();
+            size_t found = rows_;
+            for (size_t r = pivotRow; r < rows_ && found == rows_; ++r) {
+                uint64_t* target = row(r);
+                for (size_t t = reduced[r]; t < blockCols.size(); ++t) {
+                    size_t c = blockCols[t];
+                    if ((target[c / 64] >> (c % 64)) & 1) {
+                        xorWords(target + firstWord, row(currentRow + t) + firstWord, tailWords);
+                    }
+                }
+                reduced[r] = blockCols.size();
+                if ((target[word] & mask) != 0) {
+                    found = r;
+                }
+            }
+            if (found == rows_) {
+                continue;
+            }
+            if (found != pivotRow) {
+                std::swap_ranges(row(pivotRow) + firstWord, row(pivotRow) + words_,
+                                 row(found) + firstWord);
+                std::swap(reduced[pivotRow], reduced[found]);
+            }
+            blockCols.push_back(col);
+            pivotCols.push_back(col);
+        }
+
+        size_t pivots = blockCols.size();
+        if (pivots == 0) {
+            break;
+        }
+
+        // Ведущие строки, приведённые друг относительно друга: строка t
+        // содержит единицу только в ведущем столбце t своего блока
+        std::vector<uint64_t> basis(pivots * tailWords);
+        for (size_t t = 0; t < pivots; ++t) {
+            std::copy(row(currentRow + t) + firstWord, row(currentRow + t) + words_,
+                      basis.begin() + t * tailWords);
+        }
+        for (size_t t = pivots; t-- > 0;) {
+            uint64_t* target = basis.data() + t * tailWords;
+            for (size_t u = t + 1; u < pivots; ++u) {
+                size_t c = blockCols[u] - firstWord * 64;
+                if ((target[c / 64] >> (c % 64)) & 1) {
+                    xorWords(target, basis.data() + u * tailWords, tailWords);
+                }
+            }
+        }
+        if (backward) {
+            for (size_t t = 0; t < pivots; ++t) {
+                std::copy(basis.begin() + t * tailWords, basis.begin() + (t + 1) * tailWords,
+                          row(currentRow + t) + firstWord);
+            }
+        }
+
+        // Таблица комбинаций в порядке кода Грея
+        size_t tableSize = size_t(1) << pivots;
+        table.assign(tableSize * tailWords, 0);
+        for (size_t i = 1; i < tableSize; ++i) {
+            size_t gray = i ^ (i >> 1);
+            size_t prevGray = (i - 1) ^ ((i - 1) >> 1);
+            const uint64_t* prev = table.data() + prevGray * tailWords;
+            const uint64_t* src = basis.data() + detail::countTrailingZeros(i) * tailWords;
+            uint64_t* dest = table.data() + gray * tailWords;
+            for (size_t w = 0; w < tailWords; ++w) {
+                dest[w] = prev[w] ^ src[w];
+            }
+        }
+
+        // Очистка ведущих столбцов блока в остальных строках
+        size_t firstRow = backward ? 0 : currentRow + pivots;
+        for (size_t r = firstRow; r < rows_; ++r) {
+            if (r == currentRow) {
+                r += pivots - 1;
+                continue;
+            }
+            uint64_t* target = row(r) + firstWord;
+            size_t index = 0;
+            for (size_t t = 0; t < pivots; ++t) {
+                size_t c = blockCols[t] - firstWord * 64;
+                index |= ((target[c / 64] >> (c % 64)) & 1) << t;
+            }
+            if (index != 0) {
+                xorWords(target, table.data() + index * tailWords, tailWords);
+            }
+        }
+
+        currentRow += pivots;
+    }
+
+    return currentRow;
+}
+
+BitGaussResult BitMatrix::forwardGauss() const {
+    BitGaussResult result(*this);
+    result.rank = result.matrix.eliminate(false, result.pivotCols);
+    return result;
+}
+
+BitGaussResult BitMatrix::reducedRowEchelonForm() const {
+    BitGaussResult result(*this);
+    result.rank = result.matrix.eliminate(true, result.pivotCols);
+    return result;
+}
+
+size_t BitMatrix::rank() const {
+    BitMatrix work = *this;
+    std::vector<size_t> pivotCols;
+    return work.eliminate(false, pivotCols);
+}
+
+bool BitMatrix::isInvertible() const {
+    if (rows_ != cols_) {
+        return false;
+    }
+    return rank() == rows_;
+}
+
+std::optional<BitMatrix> BitMatrix::inverse() const {
+    if (rows_ != cols_) {
+        return std::nullopt;
+    }
+
+    // Расширенная матрица [A | I]; правая половина начинается с границы
+    // слова, чтобы её можно было скопировать целыми словами
+    size_t offset = words_;
+    BitMatrix augmented(rows_, offset * 64 + cols_);
+    for (size_t i = 0; i < rows_; ++i) {
+        std::copy(row(i), row(i) + words_, augmented.row(i));
+        augmented.row(i)[offset + i / 64] |= uint64_t(1) << (i % 64);
+    }
+
+    std::vector<size_t> pivotCols;
+    size_t r = augmented.eliminate(true, pivotCols);
+    if (r < rows_ || (rows_ > 0 && pivotCols[rows_ - 1] != rows_ - 1)) {
+        return std::nullopt;
+    }
+
+    BitMatrix inv(rows_, cols_);
+    for (size_t i = 0; i < rows_; ++i) {
+        std::copy(augmented.row(i) + offset, augmented.row(i) + offset + words_,
+                  inv.row(i));
+    }
+    return inv;
+}
+
+bool BitMatrix::operator==(const BitMatrix& other) const {
+    if (rows_ != other.rows_ || cols_ != other.cols_) {
+        return false;
+    }
+    return data_ == other.data_;
+}
+
+bool BitMatrix::operator!=(const BitMatrix& other) const {
+    return !(*this == other);
+}
+
+std::ostream& operator<<(std::ostream& os, const BitMatrix& mat) {
+    for (size_t i = 0; i < mat.rows_; ++i) {
+        os << "[";
+        for (size_t j = 0; j < mat.cols_; ++j) {
+            if (j > 0) os << " ";
+            os << std::setw(4) << ((mat.row(i)[j / 64] >> (j % 64)) & 1);
+        }
+        os << " ]";
+        if (i < mat.rows_ - 1) os << "\n";
+    }
+    return os;
+}
+
+} // namespace matrix_gf2
@@ -0,0 +1,30 @@
+#ifndef MATRIX_GF2_SRC_BIT_OPS_HPP
+#define MATRIX_GF2_SRC_BIT_OPS_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace matrix_gf2 {
+namespace detail {
+
+/**
+ * @brief Номер младшего установленного бита (x != 0)
+ */
+inline size_t countTrailingZeros(uint64_t x) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<size_t>(index);
+#else
+    return static_cast<size_t>(__builtin_ctzll(x));
+#endif
+}
+
+} // namespace detail
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_SRC_BIT_OPS_HPP
@@ -0,0 +1,452 @@
+#include "../include/matrix_gf2/field.hpp"
+#include "../include/matrix_gf2/binary_field.hpp"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+
+namespace matrix_gf2 {
+
+namespace {
+
+// Максимальная степень расширения, при которой p^m помещается в 64 бита
+constexpr size_t kMaxDegree = 64;
+
+// Признак отсутствия логарифма Зеха (1 + g^k = 0)
+constexpr uint32_t kNoZech = UINT32_MAX;
+
+// Сколько кандидатов проверять при поиске примитивного элемента
+constexpr uint64_t kMaxGeneratorCandidates = 4096;
+
+using FieldKey = std::tuple<uint64_t, uint32_t, std::vector<uint32_t>>;
+
+std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<FieldKey, std::unique_ptr<Field>>& registry() {
+    static std::map<FieldKey, std::unique_ptr<Field>> fields;
+    return fields;
+}
+
+// Приведение коэффициентов модуля к каноническому виду
+std::vector<uint32_t> normalizeModulus(uint64_t p, uint32_t m,
+                                       const std::vector<uint32_t>& modulus) {
+    if (m == 1) {
+        return {1, 1};
+    }
+    std::vector<uint32_t> result(modulus);
+    for (auto& c : result) {
+        c %= p;
+    }
+    while (!result.empty() && result.back() == 0) {
+        result.pop_back();
+    }
+    return result;
+}
+
+} // namespace
+
+const Field& Field::get(uint64_t p, uint32_t m, const std::vector<uint32_t>& modulus) {
+    if (p < 2) {
+        throw std::invalid_argument("Характеристика поля должна быть >= 2");
+    }
+    if (p >= kMaxPrime) {
+        throw std::invalid_argument("Характеристика поля должна быть меньше 2^63");
+    }
+    if (m < 1) {
+        throw std::invalid_argument("Степень расширения должна быть >= 1");
+    }
+
+    FieldKey key(p, m, normalizeModulus(p, m, modulus));
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+    auto& fields = registry();
+    auto it = fields.find(key);
+    if (it == fields.end()) {
+        std::unique_ptr<Field> field(new Field(p, m, std::get<2>(key)));
+        it = fields.emplace(std::move(key), std::move(field)).first;
+    }
+    return *it->second;
+}
+
+Field::Field(uint64_t p, uint32_t m, const std::vector<uint32_t>& modulus)
+    : p_(p), m_(m), modulus_(modulus), maxValue_(0), modulusLeadInv_(1),
+      binaryModulus_(0), useClmul_(false), barrettMu_(0), montInv_(0),
+      montR2_(0) {
+    if (m > 1 && modulus_.size() != static_cast<size_t>(m) + 1) {
+        throw std::invalid_argument("Степень модуля должна совпадать со степенью расширения");
+    }
+
+    // p^m - 1 должно помещаться в 64 бита
+    uint64_t order = 1;
+    for (uint32_t i = 0; i < m; ++i) {
+        if (order > UINT64_MAX / p) {
+            bool lastFullWord = (p == 2 && i + 1 == m && order == (uint64_t(1) << 63));
+            if (!lastFullWord || m > kMaxDegree) {
+                throw std::invalid_argument("Порядок поля не помещается в 64 бита");
+            }
+            order = 0;  // 2^64
+            break;
+        }
+        order *= p;
+    }
+    maxValue_ = order - 1;
+    
+    if (p == 2 && m > 1) {
+        binaryModulus_ = pack(modulus_.data());
+        
+        // Безпереносное умножение выгодно, когда приведение укладывается
+        // в две свертки: 2 deg r <= m
+        uint32_t degree = 0;
+        for (uint64_t r = binaryModulus_ >> 1; r != 0; r >>= 1) {
+            ++degree;
+        }
+        useClmul_ = 2 * degree <= m;
+    }
+
+    if (m == 1) {
+        initReduction();
+        if (p <= kMaxTableOrder) {
+            buildInverseTable();
+        }
+    }
+    
+    if (m > 1) {
+        modulusLeadInv_ = static_cast<uint32_t>(invModP(modulus_.back()));
+        
+        if (maxValue_ < kMaxTableOrder) {
+            buildLogTables();
+        }
+    }
+}
+
+void Field::initReduction() {
+    barrettMu_ = UINT64_MAX / p_;
+    
+    if (p_ >= kBarrettLimit) {
+        // p нечётно: обратный к p по модулю 2^64 методом Ньютона
+        uint64_t inv = p_;
+        for (int i = 0; i < 5; ++i) {
+            inv *= 2 - p_ * inv;
+        }
+        montInv_ = 0 - inv;
+        
+        // 2^128 mod p: 2^64 mod p, затем ещё 64 удвоения
+        uint64_t r = (UINT64_MAX % p_ + 1) % p_;
+        for (int i = 0; i < 64; ++i) {
+            r <<= 1;
+            if (r >= p_) r -= p_;
+        }
+        montR2_ = r;
+    }
+}
+
+void Field::buildInverseTable() {
+    // inv(i) = -(p / i) * inv(p mod i), так как p = (p / i) * i + p mod i
+    std::vector<uint32_t> table(p_);
+    table[1] = 1;
+    for (uint64_t i = 2; i < p_; ++i) {
+        uint64_t t = (uint64_t(p_ / i) * table[p_ % i]) % p_;
+        table[i] = static_cast<uint32_t>(t == 0 ? 0 : p_ - t);
+    }
+    invTable_ = std::move(table);
+}
+
+uint64_t Field::invModP(uint64_t a) const {
+    if (!invTable_.empty()) {
+        return invTable_[a];
+    }
+    
+    // Расширенный алгоритм Евклида: поддерживаем r_i = s_i * a (mod p)
+    int64_t r0 = static_cast<int64_t>(p_);
+    int64_t r1 = static_cast<int64_t>(a % p_);
+    int64_t s0 = 0;
+    int64_t s1 = 1;
+    while (r1 != 0) {
+        int64_t q = r0 / r1;
+        int64_t r2 = r0 - q * r1;
+        int64_t s2 = s0 - q * s1;
+        r0 = r1;
+        r1 = r2;
+        s0 = s1;
+        s1 = s2;
+    }
+    if (r0 != 1) {
+        throw std::runtime_error("Обратный элемент не найден");
+    }
+    return static_cast<uint64_t>(s0 < 0 ? s0 + static_cast<int64_t>(p_) : s0);
+}
+
+void Field::buildLogTables() {
+    const uint64_t n = maxValue_;  // Порядок мультипликативной группы
+    
+    // Простые делители порядка группы
+    std::vector<uint64_t> primes;
+    uint64_t rest = n;
+    for (uint64_t d = 2; d * d <= rest; ++d) {
+        if (rest % d == 0) {
+            primes.push_back(d);
+            while (rest % d == 0) rest /= d;
+        }
+    }
+    if (rest > 1) primes.push_back(rest);
+    
+    // Поиск примитивного элемента: g^(n/r) != 1 для всех простых r | n
+    uint64_t generator = 0;
+    for (uint64_t g = 2; g <= n && g < kMaxGeneratorCandidates; ++g) {
+        bool primitive = true;
+        for (uint64_t r : primes) {
+            if (pow(g, n / r) == 1) {
+                primitive = false;
+                break;
+            }
+        }
+        if (primitive) {
+            generator = g;
+            break;
+        }
+    }
+    if (generator == 0) {
+        return;  // Модуль приводим или поле слишком мало - остаёмся на общем пути
+    }
+    
+    std::vector<uint32_t> expTable(2 * n);
+    std::vector<uint32_t> logTable(n + 1, kNoZech);
+    uint64_t x = 1;
+    for (uint64_t i = 0; i < n; ++i) {
+        if (logTable[x] != kNoZech) {
+            return;  // Степени повторяются: модуль не является неприводимым
+        }
+        expTable[i] = expTable[i + n] = static_cast<uint32_t>(x);
+        logTable[x] = static_cast<uint32_t>(i);
+        x = mulPoly(x, generator);
+    }
+    logTable[0] = 0;
+    
+    std::vector<uint32_t> zechTable;
+    if (p_ != 2) {
+        zechTable.resize(n);
+        for (uint64_t k = 0; k < n; ++k) {
+            uint64_t sum = addPoly(1, expTable[k]);
+            zechTable[k] = sum == 0 ? kNoZech : logTable[sum];
+        }
+    }
+    
+    exp_ = std::move(expTable);
+    log_ = std::move(logTable);
+    zech_ = std::move(zechTable);
+}
+
+void Field::unpack(uint64_t value, uint32_t* digits) const {
+    if (p_ == 2) {
+        for (uint32_t i = 0; i < m_; ++i) {
+            digits[i] = static_cast<uint32_t>((value >> i) & 1);
+        }
+        return;
+    }
+    for (uint32_t i = 0; i < m_; ++i) {
+        digits[i] = static_cast<uint32_t>(value % p_);
+        value /= p_;
+    }
+}
+
+uint64_t Field::pack(const uint32_t* digits) const {
+    if (p_ == 2) {
+        uint64_t value = 0;
+        for (uint32_t i = 0; i < m_; ++i) {
+            value |= uint64_t(digits[i]) << i;
+        }
+        return value;
+    }
+    uint64_t value = 0;
+    for (uint32_t i = m_; i-- > 0;) {
+        value = value * p_ + digits[i];
+    }
+    return value;
+}
+
+void Field::reducePoly(uint64_t* poly, size_t len) const {
+    for (size_t deg = len; deg-- > m_;) {
+        uint64_t coeff = (poly[deg] * modulusLeadInv_) % p_;
+        if (coeff == 0) {
+            continue;
+        }
+        // Вычитаем модуль, умноженный на coeff * x^(deg - m)
+        size_t shift = deg - m_;
+        for (size_t i = 0; i <= m_; ++i) {
+            uint64_t t = (coeff * modulus_[i]) % p_;
+            poly[shift + i] = (poly[shift + i] + p_ - t) % p_;
+        }
+    }
+}
+
+uint64_t Field::addPoly(uint64_t a, uint64_t b) const {
+    if (!zech_.empty()) {
+        // g^i + g^j = g^i (1 + g^(j - i)) = g^(i + Z(j - i))
+        if (a == 0) return b;
+        if (b == 0) return a;
+        uint32_t n = static_cast<uint32_t>(maxValue_);
+        uint32_t la = log_[a];
+        uint32_t lb = log_[b];
+        uint32_t z = zech_[lb >= la ? lb - la : lb + n - la];
+        return z == kNoZech ? 0 : exp_[la + z];
+    }
+    
+    uint32_t da[kMaxDegree];
+    uint32_t db[kMaxDegree];
+    unpack(a, da);
+    unpack(b, db);
+    for (uint32_t i = 0; i < m_; ++i) {
+        uint64_t s = uint64_t(da[i]) + db[i];
+        da[i] = static_cast<uint32_t>(s >= p_ ? s - p_ : s);
+    }
+    return pack(da);
+}
+
+uint64_t Field::subPoly(uint64_t a, uint64_t b) const {
+    if (!zech_.empty()) {
+        // -1 = g^(n/2) для нечётной характеристики
+        if (b == 0) return a;
+        uint32_t n = static_cast<uint32_t>(maxValue_);
+        return addPoly(a, exp_[log_[b] + n / 2]);
+    }
+    
+    uint32_t da[kMaxDegree];
+    uint32_t db[kMaxDegree];
+    unpack(a, da);
+    unpack(b, db);
+    for (uint32_t i = 0; i < m_; ++i) {
+        da[i] = da[i] >= db[i] ? da[i] - db[i] : da[i] + p_ - db[i];
+    }
+    return pack(da);
+}
+
+uint64_t Field::mulPoly(uint64_t a, uint64_t b) const {
+    if (useClmul_) {
+        uint64_t hi, lo;
+        detail::clmul64(a, b, hi, lo);
+        return detail::clmulReduce(hi, lo, m_, binaryModulus_);
+    }
+    
+    if (p_ == 2) {
+        // Схема Горнера: сдвиг на x с приведением и XOR по битам b
+        const uint64_t modLow = binaryModulus_;
+        uint64_t result = 0;
+        for (uint32_t i = m_; i-- > 0;) {
+            uint64_t carry = (result >> (m_ - 1)) & 1;
+            result = (result << 1) & maxValue_;
+            if (carry) result ^= modLow;
+            if ((b >> i) & 1) result ^= a;
+        }
+        return result;
+    }
+    
+    uint32_t da[kMaxDegree];
+    uint32_t db[kMaxDegree];
+    uint64_t product[2 * kMaxDegree - 1] = {};
+    unpack(a, da);
+    unpack(b, db);
+    
+    // Умножение полиномов "в столбик"; если сумма m произведений помещается
+    // в 64 бита, приведение по модулю p выполняется один раз на коэффициент
+    const uint64_t maxTerm = uint64_t(p_ - 1) * (p_ - 1);
+    const bool lazy = maxTerm <= UINT64_MAX / m_;
+    for (uint32_t i = 0; i < m_; ++i) {
+        if (da[i] == 0) continue;
+        for (uint32_t j = 0; j < m_; ++j) {
+            uint64_t t = product[i + j] + uint64_t(da[i]) * db[j];
+            product[i + j] = lazy ? t : t % p_;
+        }
+    }
+    if (lazy) {
+        for (uint32_t k = 0; k < 2 * m_ - 1; ++k) {
+            product[k] %= p_;
+        }
+    }
+    
+    reducePoly(product, 2 * m_ - 1);
+    
+    for (uint32_t i = 0; i < m_; ++i) {
+        da[i] = static_cast<uint32_t>(product[i]);
+    }
+    return pack(da);
+}
+
+uint64_t Field::pow(uint64_t a, uint64_t e) const {
+    uint64_t result = 1;
+    while (e > 0) {
+        if (e & 1) {
+            result = mul(result, a);
+        }
+        a = mul(a, a);
+        e >>= 1;
+    }
+    return result;
+}
+
+uint64_t Field::inv(uint64_t a) const {
+    if (a == 0) {
+        throw std::invalid_argument("Ноль не имеет обратного элемента");
+    }
+
+    if (m_ == 1) {
+        return invModP(a);
+    }
+
+    if (!exp_.empty()) {
+        return exp_[maxValue_ - log_[a]];
+    }
+    
+    // Мультипликативная группа имеет порядок p^m - 1, поэтому a^(-1) = a^(p^m - 2)
+    return pow(a, maxValue_ - 1);
+}
+
+uint64_t Field::div(uint64_t a, uint64_t b) const {
+    if (b == 0) {
+        throw std::invalid_argument("Деление на ноль");
+    }
+    if (!exp_.empty()) {
+        return a == 0 ? 0 : exp_[log_[a] + maxValue_ - log_[b]];
+    }
+    return mul(a, inv(b));
+}
+
+uint64_t Field::fromInt(uint64_t value) const {
+    if (m_ == 1) {
+        return value % p_;
+    }
+    if (maxValue_ == UINT64_MAX) {
+        return value;
+    }
+    return value % (maxValue_ + 1);
+}
+
+uint64_t Field::fromCoeffs(const std::vector<uint32_t>& coeffs) const {
+    if (m_ == 1) {
+        return coeffs.empty() ? 0 : coeffs[0] % p_;
+    }
+
+    std::vector<uint64_t> poly(std::max(coeffs.size(), static_cast<size_t>(m_)), 0);
+    for (size_t i = 0; i < coeffs.size(); ++i) {
+        poly[i] = coeffs[i] % p_;
+    }
+    reducePoly(poly.data(), poly.size());
+
+    uint32_t digits[kMaxDegree];
+    for (uint32_t i = 0; i < m_; ++i) {
+        digits[i] = static_cast<uint32_t>(poly[i]);
+    }
+    return pack(digits);
+}
+
+std::vector<uint32_t> Field::toCoeffs(uint64_t value) const {
+    std::vector<uint32_t> coeffs(m_);
+    unpack(value, coeffs.data());
+    return coeffs;
+}
+
+} // namespace matrix_gf2
@@ -0,0 +1,359 @@
+#include "gemm_prime.hpp"
+#include "../include/matrix_gf2/aligned_allocator.hpp"
+#include <algorithm>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define MATRIX_GF2_GEMM_DISPATCH 1
+#endif
+
+namespace matrix_gf2 {
+namespace detail {
+
+namespace {
+
+// Плитка микроядра (строки x столбцы C) - 32 сумматора в регистрах
+constexpr size_t kGemmMR = 4;
+constexpr size_t kGemmNR = 8;
+
+// Блоки по кэшу: панель B (KC x NC) - в L2, панель A (MC x KC) - в L1/L2
+constexpr size_t kGemmKC = 256;
+constexpr size_t kGemmMC = 64;
+constexpr size_t kGemmNC = 512;
+
+// Ширина плитки ядра с плавающей точкой для AVX-512 (два регистра на строку)
+constexpr size_t kGemmNRWide = 16;
+
+template <typename T>
+using PackedBuffer = std::vector<T, AlignedAllocator<T>>;
+
+// Упаковка блока B (kc x nc) в панели по nr столбцов: для каждого шага t
+// подряд идут nr значений строки t; недостающие столбцы - нули
+template <typename T>
+void packB(ConstBlock b, size_t kc, size_t nc, size_t nr, T* dest) {
+    for (size_t j0 = 0; j0 < nc; j0 += nr) {
+        size_t width = std::min(nr, nc - j0);
+        for (size_t t = 0; t < kc; ++t) {
+            const uint64_t* src = b.row(t) + j0;
+            for (size_t j = 0; j < nr; ++j) {
+                dest[j] = j < width ? static_cast<T>(src[j]) : T(0);
+            }
+            dest += nr;
+        }
+    }
+}
+
+// Упаковка блока A (mc x kc) в панели по kGemmMR строк: для каждого шага t
+// подряд идут kGemmMR значений столбца t
+template <typename T>
+void packA(ConstBlock a, size_t mc, size_t kc, T* dest) {
+    for (size_t i0 = 0; i0 < mc; i0 += kGemmMR) {
+        size_t height = std::min(kGemmMR, mc - i0);
+        for (size_t t = 0; t < kc; ++t) {
+            for (size_t i = 0; i < kGemmMR; ++i) {
+                dest[i] = i < height ? static_cast<T>(a.row(i0 + i)[t]) : T(0);
+            }
+            dest += kGemmMR;
+        }
+    }
+}
+
+// Микроядро: acc = сумма по t произведений столбца панели A на строку панели B
+void microKernelScalar(const uint32_t* a, const uint32_t* b, size_t kc,
+                       uint64_t acc[kGemmMR][kGemmNR]) {
+    for (size_t i = 0; i < kGemmMR; ++i) {
+        for (size_t j = 0; j < kGemmNR; ++j) {
+            acc[i][j] = 0;
+        }
+    }
+    for (size_t t = 0; t < kc; ++t) {
+        for (size_t i = 0; i < kGemmMR; ++i) {
+            uint64_t x = a[i];
+            for (size_t j = 0; j < kGemmNR; ++j) {
+                acc[i][j] += x * b[j];
+            }
+        }
+        a += kGemmMR;
+        b += kGemmNR;
+    }
+}
+
+#if defined(MATRIX_GF2_GEMM_DISPATCH)
+// 32 x 32 -> 64-битные произведения (VPMULUDQ): строка плитки - два регистра
+__attribute__((target("avx2")))
+void microKernelAvx2(const uint32_t* a, const uint32_t* b, size_t kc,
+                     uint64_t acc[kGemmMR][kGemmNR]) {
+    __m256i c[kGemmMR][2];
+    for (size_t i = 0; i < kGemmMR; ++i) {
+        c[i][0] = _mm256_setzero_si256();
+        c[i][1] = _mm256_setzero_si256();
+    }
+    for (size_t t = 0; t < kc; ++t) {
+        __m256i row = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+        __m256i b0 = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(row));
+        __m256i b1 = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(row, 1));
+        for (size_t i = 0; i < kGemmMR; ++i) {
+            __m256i x = _mm256_set1_epi64x(static_cast<long long>(a[i]));
+            c[i][0] = _mm256_add_epi64(c[i][0], _mm256_mul_epu32(x, b0));
+            c[i][1] = _mm256_add_epi64(c[i][1], _mm256_mul_epu32(x, b1));
+        }
+        a += kGemmMR;
+        b += kGemmNR;
+    }
+    for (size_t i = 0; i < kGemmMR; ++i) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc[i]), c[i][0]);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc[i] + 4), c[i][1]);
+    }
+}
+
+// Ложные предупреждения GCC 12 о неинициализированном '__Y' во встроенных
+// _mm512_cvtepu32_epi64 и _mm512_mul_epu32 (GCC bug 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// То же для AVX-512: строка плитки помещается в один регистр
+__attribute__((target("avx512f")))
+void microKernelAvx512(const uint32_t* a, const uint32_t* b, size_t kc,
+                       uint64_t acc[kGemmMR][kGemmNR]) {
+    __m512i c[kGemmMR];
+    for (size_t i = 0; i < kGemmMR; ++i) {
+        c[i] = _mm512_setzero_si512();
+    }
+    for (size_t t = 0; t < kc; ++t) {
+        __m512i row = _mm512_cvtepu32_epi64(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b)));
+        for (size_t i = 0; i < kGemmMR; ++i) {
+            __m512i x = _mm512_set1_epi64(static_cast<long long>(a[i]));
+            c[i] = _mm512_add_epi64(c[i], _mm512_mul_epu32(x, row));
+        }
+        a += kGemmMR;
+        b += kGemmNR;
+    }
+    for (size_t i = 0; i < kGemmMR; ++i) {
+        _mm512_storeu_si512(acc[i], c[i]);
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif // MATRIX_GF2_GEMM_DISPATCH
+
+using MicroKernel = void (*)(const uint32_t*, const uint32_t*, size_t,
+                             uint64_t[kGemmMR][kGemmNR]);
+
+// Выбор микроядра по набору инструкций (один раз)
+MicroKernel selectMicroKernel() {
+#if defined(MATRIX_GF2_GEMM_DISPATCH)
+    if (__builtin_cpu_supports("avx512f")) return microKernelAvx512;
+    if (__builtin_cpu_supports("avx2")) return microKernelAvx2;
+#endif
+    return microKernelScalar;
+}
+
+// Микроядро с плавающей точкой: acc (kGemmMR x nr) = сумма произведений,
+// все частичные суммы - целые числа меньше 2^53 и вычисляются точно
+using DoubleKernel = void (*)(const double*, const double*, size_t, double*);
+
+struct DoubleKernelInfo {
+    DoubleKernel kernel;
+    size_t nr;
+    bool vectorized;
+};
+
+void doubleKernelScalar(const double* a, const double* b, size_t kc, double* acc) {
+    std::fill(acc, acc + kGemmMR * kGemmNR, 0.0);
+    for (size_t t = 0; t < kc; ++t) {
+        for (size_t i = 0; i < kGemmMR; ++i) {
+            double x = a[i];
+            for (size_t j = 0; j < kGemmNR; ++j) {
+                acc[i * kGemmNR + j] += x * b[j];
+            }
+        }
+        a += kGemmMR;
+        b += kGemmNR;
+    }
+}
+
+#if defined(MATRIX_GF2_GEMM_DISPATCH)
+// Плитка 4 x 8: 8 независимых цепочек FMA
+__attribute__((target("avx2,fma")))
+void doubleKernelAvx2(const double* a, const double* b, size_t kc, double* acc) {
+    __m256d c[kGemmMR][2];
+    for (size_t i = 0; i < kGemmMR; ++i) {
+        c[i][0] = _mm256_setzero_pd();
+        c[i][1] = _mm256_setzero_pd();
+    }
+    for (size_t t = 0; t < kc; ++t) {
+        __m256d b0 = _mm256_loadu_pd(b);
+        __m256d b1 = _mm256_loadu_pd(b + 4);
+        for (size_t i = 0; i < kGemmMR; ++i) {
+            __m256d x = _mm256_broadcast_sd(a + i);
+            c[i][0] = _mm256_fmadd_pd(x, b0, c[i][0]);
+            c[i][1] = _mm256_fmadd_pd(x, b1, c[i][1]);
+        }
+        a += kGemmMR;
+        b += kGemmNR;
+    }
+    for (size_t i = 0; i < kGemmMR; ++i) {
+        _mm256_storeu_pd(acc + i * kGemmNR, c[i][0]);
+        _mm256_storeu_pd(acc + i * kGemmNR + 4, c[i][1]);
+    }
+}
+
+// Плитка 4 x 16: 8 независимых цепочек FMA в регистрах AVX-512
+__attribute__((target("avx512f")))
+void doubleKernelAvx512(const double* a, const double* b, size_t kc, double* acc) {
+    __m512d c[kGemmMR][2];
+    for (size_t i = 0; i < kGemmMR; ++i) {
+        c[i][0] = _mm512_setzero_pd();
+        c[i][1] = _mm512_setzero_pd();
+    }
+    for (size_t t = 0; t < kc; ++t) {
+        __m512d b0 = _mm512_loadu_pd(b);
+        __m512d b1 = _mm512_loadu_pd(b + 8);
+        for (size_t i = 0; i < kGemmMR; ++i) {
+            __m512d x = _mm512_set1_pd(a[i]);
+            c[i][0] = _mm512_fmadd_pd(x, b0, c[i][0]);
+            c[i][1] = _mm512_fmadd_pd(x, b1, c[i][1]);
+        }
+        a += kGemmMR;
+        b += kGemmNRWide;
+    }
+    for (size_t i = 0; i < kGemmMR; ++i) {
+        _mm512_storeu_pd(acc + i * kGemmNRWide, c[i][0]);
+        _mm512_storeu_pd(acc + i * kGemmNRWide + 8, c[i][1]);
+    }
+}
+#endif // MATRIX_GF2_GEMM_DISPATCH
+
+DoubleKernelInfo selectDoubleKernel() {
+#if defined(MATRIX_GF2_GEMM_DISPATCH)
+    if (__builtin_cpu_supports("avx512f")) return {doubleKernelAvx512, kGemmNRWide, true};
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return {doubleKernelAvx2, kGemmNR, true};
+    }
+#endif
+    return {doubleKernelScalar, kGemmNR, false};
+}
+
+const DoubleKernelInfo& doubleKernel() {
+    static const DoubleKernelInfo info = selectDoubleKernel();
+    return info;
+}
+
+} // namespace
+
+bool supportsDelayedReduction(const Field& field) {
+    return field.m() == 1 && field.p() <= (uint64_t(1) << 32) &&
+           delayedReductionDepth(field.p()) >= kDelayedReductionMinDepth;
+}
+
+uint64_t delayedReductionDepth(uint64_t p) {
+    uint64_t maxProduct = (p - 1) * (p - 1);
+    return maxProduct == 0 ? UINT64_MAX : UINT64_MAX / maxProduct;
+}
+
+bool supportsDoubleKernel(const Field& field) {
+    return field.m() == 1 && field.p() < kDoubleKernelMaxPrime && doubleKernel().vectorized &&
+           doubleReductionDepth(field.p()) >= kDoubleKernelMinDepth;
+}
+
+uint64_t doubleReductionDepth(uint64_t p) {
+    uint64_t maxProduct = (p - 1) * (p - 1);
+    return maxProduct == 0 ? UINT64_MAX : (uint64_t(1) << 53) / maxProduct;
+}
+
+void gemmPrime(const Field& field, ConstBlock a, ConstBlock b, Block c,
+               size_t m, size_t k, size_t n) {
+    const uint64_t p = field.p();
+    const size_t depth = static_cast<size_t>(std::min<uint64_t>(kGemmKC, delayedReductionDepth(p)));
+
+    PackedBuffer<uint32_t> packedB(depth * ((std::min(kGemmNC, n) + kGemmNR - 1) / kGemmNR * kGemmNR));
+    PackedBuffer<uint32_t> packedA(depth * ((std::min(kGemmMC, m) + kGemmMR - 1) / kGemmMR * kGemmMR));
+    static const MicroKernel microKernel = selectMicroKernel();
+    uint64_t acc[kGemmMR][kGemmNR];
+
+    for (size_t jc = 0; jc < n; jc += kGemmNC) {
+        size_t nc = std::min(kGemmNC, n - jc);
+        for (size_t pc = 0; pc < k; pc += depth) {
+            size_t kc = std::min(depth, k - pc);
+            packB(b.sub(pc, jc), kc, nc, kGemmNR, packedB.data());
+
+            for (size_t ic = 0; ic < m; ic += kGemmMC) {
+                size_t mc = std::min(kGemmMC, m - ic);
+                packA(a.sub(ic, pc), mc, kc, packedA.data());
+
+                for (size_t jr = 0; jr < nc; jr += kGemmNR) {
+                    size_t width = std::min(kGemmNR, nc - jr);
+                    const uint32_t* panelB = packedB.data() + jr * kc;
+                    for (size_t ir = 0; ir < mc; ir += kGemmMR) {
+                        size_t height = std::min(kGemmMR, mc - ir);
+                        microKernel(packedA.data() + ir * kc, panelB, kc, acc);
+
+                        // Единственное приведение по модулю на блок глубины kc
+                        for (size_t i = 0; i < height; ++i) {
+                            uint64_t* cr = c.row(ic + ir + i) + jc + jr;
+                            for (size_t j = 0; j < width; ++j) {
+                                uint64_t sum = cr[j] + acc[i][j] % p;
+                                cr[j] = sum >= p ? sum - p : sum;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void gemmPrimeDouble(const Field& field, ConstBlock a, ConstBlock b, Block c,
+                     size_t m, size_t k, size_t n) {
+    const uint64_t p = field.p();
+    const size_t depth = static_cast<size_t>(std::min<uint64_t>(kGemmKC, doubleReductionDepth(p)));
+    const DoubleKernelInfo& kernel = doubleKernel();
+    const size_t nr = kernel.nr;
+
+    PackedBuffer<double> packedB(depth * ((std::min(kGemmNC, n) + nr - 1) / nr * nr));
+    PackedBuffer<double> packedA(depth * ((std::min(kGemmMC, m) + kGemmMR - 1) / kGemmMR * kGemmMR));
+    double acc[kGemmMR * kGemmNRWide];
+
+    for (size_t jc = 0; jc < n; jc += kGemmNC) {
+        size_t nc = std::min(kGemmNC, n - jc);
+        for (size_t pc = 0; pc < k; pc += depth) {
+            size_t kc = std::min(depth, k - pc);
+            packB(b.sub(pc, jc), kc, nc, nr, packedB.data());
+
+            for (size_t ic = 0; ic < m; ic += kGemmMC) {
+                size_t mc = std::min(kGemmMC, m - ic);
+                packA(a.sub(ic, pc), mc, kc, packedA.data());
+
+                for (size_t jr = 0; jr < nc; jr += nr) {
+                    size_t width = std::min(nr, nc - jr);
+                    const double* panelB = packedB.data() + jr * kc;
+                    for (size_t ir = 0; ir < mc; ir += kGemmMR) {
+                        size_t height = std::min(kGemmMR, mc - ir);
+                        kernel.kernel(packedA.data() + ir * kc, panelB, kc, acc);
+
+                        // Точная целая сумма < 2^53: приведение на границе блока
+                        // (через uint64_t - std::fmod заметно медленнее)
+                        for (size_t i = 0; i < height; ++i) {
+                            uint64_t* cr = c.row(ic + ir + i) + jc + jr;
+                            const double* ar = acc + i * nr;
+                            for (size_t j = 0; j < width; ++j) {
+                                uint64_t sum = cr[j] + static_cast<uint64_t>(ar[j]) % p;
+                                cr[j] = sum >= p ? sum - p : sum;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace detail
+} // namespace matrix_gf2
@@ -0,0 +1,68 @@
+#ifndef MATRIX_GF2_SRC_GEMM_PRIME_HPP
+#define MATRIX_GF2_SRC_GEMM_PRIME_HPP
+
+#include "matrix_multiply.hpp"
+
+namespace matrix_gf2 {
+namespace detail {
+
+// Меньшая глубина блока (p > 2^30) не окупает упаковку: приведение
+// после каждого слагаемого медленнее арифметики поля
+constexpr uint64_t kDelayedReductionMinDepth = 16;
+
+/**
+ * @brief Можно ли (и выгодно ли) умножать над полем с отложенным приведением
+ *
+ * Требуется простое поле (m = 1) с (p - 1)^2 < 2^64, т.е. p <= 2^32, и
+ * глубина блока не меньше kDelayedReductionMinDepth.
+ */
+bool supportsDelayedReduction(const Field& field);
+
+/**
+ * @brief Сколько произведений (p - 1)^2 можно сложить в uint64_t без переполнения
+ */
+uint64_t delayedReductionDepth(uint64_t p);
+
+/**
+ * @brief C += A * B над GF(p) с отложенным приведением
+ *
+ * Блоки A и B упаковываются в непрерывные панели 32-битных значений;
+ * микроядро накапливает плитку kGemmMR x kGemmNR произведений в 64-битных
+ * сумматорах и приводит их по модулю p только в конце блока глубины,
+ * не превышающей delayedReductionDepth(p).
+ */
+void gemmPrime(const Field& field, ConstBlock a, ConstBlock b, Block c,
+               size_t m, size_t k, size_t n);
+
+// Ядро с плавающей точкой: p < 2^26, так что (p - 1)^2 < 2^52 и хотя бы два
+// произведения складываются точно; при меньшей глубине блока выгоднее gemmPrime
+constexpr uint64_t kDoubleKernelMaxPrime = uint64_t(1) << 26;
+constexpr uint64_t kDoubleKernelMinDepth = 32;
+
+/**
+ * @brief Можно ли (и выгодно ли) умножать над полем в double с FMA
+ *
+ * Требуется простое поле с p < 2^26, глубина блока не меньше
+ * kDoubleKernelMinDepth и векторное микроядро (AVX2 + FMA или AVX-512).
+ */
+bool supportsDoubleKernel(const Field& field);
+
+/**
+ * @brief Сколько произведений (p - 1)^2 можно сложить в double точно (сумма <= 2^53)
+ */
+uint64_t doubleReductionDepth(uint64_t p);
+
+/**
+ * @brief C += A * B над GF(p) в арифметике double
+ *
+ * Блоки упаковываются в панели double; векторное микроядро на FMA
+ * накапливает точные целые суммы, которые приводятся по модулю p на
+ * границе блока глубины doubleReductionDepth(p).
+ */
+void gemmPrimeDouble(const Field& field, ConstBlock a, ConstBlock b, Block c,
+                     size_t m, size_t k, size_t n);
+
+} // namespace detail
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_SRC_GEMM_PRIME_HPP
@@ -0,0 +1,140 @@
+#include "../include/matrix_gf2/incremental_echelon.hpp"
+#include "matrix_eliminate.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace matrix_gf2 {
+
+IncrementalEchelon::IncrementalEchelon(size_t cols, const Field& field, size_t payloadCols,
+                                       bool progressive)
+    : cols_(cols), payloadCols_(payloadCols), field_(&field), progressive_(progressive),
+      rowOfPivot_(cols, cols) {}
+
+bool IncrementalEchelon::addRow(const std::vector<GFElement>& coefficients,
+                                const std::vector<GFElement>& payload) {
+    if (coefficients.size() != cols_ || payload.size() != payloadCols_) {
+        throw std::invalid_argument("Размер строки не совпадает");
+    }
+    const Field& field = *field_;
+    size_t n = width();
+    std::vector<uint64_t> row(n);
+    for (size_t j = 0; j < n; ++j) {
+        const GFElement& e = j < cols_ ? coefficients[j] : payload[j - cols_];
+        if (&e.field() != field_) {
+            throw std::invalid_argument("Строка задана над другим полем");
+        }
+        row[j] = e.raw();
+    }
+
+    // Строка k базиса имеет нули в ведущих столбцах строк 0..k-1 (а в
+    // режиме RREF - во всех чужих ведущих столбцах), поэтому приведение в
+    // порядке добавления обнуляет все ведущие столбцы
+    for (size_t k = 0; k < pivots_.size(); ++k) {
+        uint64_t f = row[pivots_[k]];
+        if (f != 0) {
+            detail::axpy(field, row.data(), basisRow(k), field.neg(f), 0, n);
+        }
+    }
+
+    size_t pivot = 0;
+    while (pivot < cols_ && row[pivot] == 0) {
+        ++pivot;
+    }
+    if (pivot == cols_) {
+        return false;
+    }
+
+    uint64_t inv = field.inv(row[pivot]);
+    for (uint64_t& value : row) {
+        value = field.mul(value, inv);
+    }
+    if (progressive_) {
+        for (size_t k = 0; k < pivots_.size(); ++k) {
+            uint64_t f = basisRow(k)[pivot];
+            if (f != 0) {
+                detail::axpy(field, basisRow(k), row.data(), field.neg(f), 0, n);
+            }
+        }
+    }
+
+    rowOfPivot_[pivot] = pivots_.size();
+    pivots_.push_back(pivot);
+    rows_.insert(rows_.end(), row.begin(), row.end());
+    return true;
+}
+
+Matrix IncrementalEchelon::basis() const {
+    Matrix result(rank(), width(), *field_);
+    for (size_t k = 0; k < rank(); ++k) {
+        GFElement* dest = result.rowData(k);
+        for (size_t j = 0; j < width(); ++j) {
+            dest[j] = GFElement::fromRaw(*field_, basisRow(k)[j]);
+        }
+    }
+    return result;
+}
+
+std::optional<std::vector<GFElement>> IncrementalEchelon::decoded(size_t col) const {
+    if (col >= cols_) {
+        throw std::out_of_range("Индекс столбца вне границ");
+    }
+    if (!progressive_) {
+        if (!isFullRank()) {
+            return std::nullopt;
+        }
+        return solution()->getRow(col);
+    }
+
+    // В RREF исходная строка определена, только если строка базиса с этим
+    // ведущим столбцом - единичный вектор коэффициентов
+    size_t k = rowOfPivot_[col];
+    if (k == cols_) {
+        return std::nullopt;
+    }
+    const uint64_t* row = basisRow(k);
+    for (size_t j = 0; j < cols_; ++j) {
+        if (j != col && row[j] != 0) {
+            return std::nullopt;
+        }
+    }
+    std::vector<GFElement> result;
+    result.reserve(payloadCols_);
+    for (size_t j = 0; j < payloadCols_; ++j) {
+        result.push_back(GFElement::fromRaw(*field_, row[cols_ + j]));
+    }
+    return result;
+}
+
+std::optional<Matrix> IncrementalEchelon::solution() const {
+    if (!isFullRank()) {
+        return std::nullopt;
+    }
+    const Field& field = *field_;
+
+    // x[pivot_k] = payload_k - sum row_k[c] * x[c] по ведущим столбцам строк,
+    // добавленных позже (в RREF сумма пуста)
+    std::vector<uint64_t> x(cols_ * payloadCols_);
+    for (size_t k = rank(); k-- > 0;) {
+        const uint64_t* row = basisRow(k);
+        uint64_t* target = x.data() + pivots_[k] * payloadCols_;
+        std::copy(row + cols_, row + width(), target);
+        for (size_t later = k + 1; later < rank() && !progressive_; ++later) {
+            uint64_t f = row[pivots_[later]];
+            if (f != 0) {
+                detail::axpy(field, target, x.data() + pivots_[later] * payloadCols_,
+                             field.neg(f), 0, payloadCols_);
+            }
+        }
+    }
+
+    Matrix result(cols_, payloadCols_, field);
+    for (size_t i = 0; i < cols_; ++i) {
+        GFElement* dest = result.rowData(i);
+        for (size_t j = 0; j < payloadCols_; ++j) {
+            dest[j] = GFElement::fromRaw(field, x[i * payloadCols_ + j]);
+        }
+    }
+    return result;
+}
+
+} // namespace matrix_gf2
@@ -0,0 +1,182 @@
+#include "../include/matrix_gf2/inverse_tracker.hpp"
+#include "../include/matrix_gf2/pluq.hpp"
+#include "matrix_eliminate.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace matrix_gf2 {
+
+namespace {
+
+// План умножения (и пул для деления строк между потоками)
+detail::MultiplyPlan planFor(const Field& field, ThreadPool* pool) {
+    MultiplyOptions options;
+    options.pool = pool;
+    return detail::planMultiply(field, options);
+}
+
+} // namespace
+
+InverseTracker::InverseTracker(size_t n, const Field& field)
+    : n_(n), field_(&field), a_(n * n), inv_(n * n) {}
+
+std::optional<InverseTracker> InverseTracker::create(const Matrix& a,
+                                                     const EliminationOptions& options) {
+    if (a.rows() != a.cols()) {
+        return std::nullopt;
+    }
+    PLUQ factors = PLUQ::factor(a, options);
+    std::optional<Matrix> inv = factors.inverse();
+    if (!inv) {
+        return std::nullopt;
+    }
+
+    size_t n = a.rows();
+    InverseTracker result(n, a.field());
+    result.pool_ = options.pool;
+    result.det_ = factors.determinant().raw();
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            result.a_[i * n + j] = a.rowData(i)[j].raw();
+            result.inv_[i * n + j] = inv->rowData(i)[j].raw();
+        }
+    }
+    return result;
+}
+
+Matrix InverseTracker::matrix() const {
+    Matrix result(n_, n_, *field_);
+    for (size_t i = 0; i < n_; ++i) {
+        for (size_t j = 0; j < n_; ++j) {
+            result.rowData(i)[j] = GFElement::fromRaw(*field_, a_[i * n_ + j]);
+        }
+    }
+    return result;
+}
+
+Matrix InverseTracker::inverse() const {
+    Matrix result(n_, n_, *field_);
+    for (size_t i = 0; i < n_; ++i) {
+        for (size_t j = 0; j < n_; ++j) {
+            result.rowData(i)[j] = GFElement::fromRaw(*field_, inv_[i * n_ + j]);
+        }
+    }
+    return result;
+}
+
+std::vector<uint64_t> InverseTracker::pack(const std::vector<GFElement>& v) const {
+    if (v.size() != n_) {
+        throw std::invalid_argument("Размер вектора не совпадает с размером матрицы");
+    }
+    std::vector<uint64_t> packed(n_);
+    for (size_t i = 0; i < n_; ++i) {
+        if (&v[i].field() != field_) {
+            throw std::invalid_argument("Вектор задан над другим полем");
+        }
+        packed[i] = v[i].raw();
+    }
+    return packed;
+}
+
+bool InverseTracker::rankOneUpdate(const std::vector<GFElement>& u,
+                                   const std::vector<GFElement>& v) {
+    std::vector<uint64_t> packedU = pack(u);
+    std::vector<uint64_t> packedV = pack(v);
+    detail::MultiplyPlan plan = planFor(*field_, pool_);
+
+    // w = A^-1 u, z = v^T A^-1
+    std::vector<uint64_t> w(n_);
+    std::vector<uint64_t> z(n_);
+    detail::multiplyParallel(*field_, plan, {inv_.data(), n_}, {packedU.data(), 1},
+                             {w.data(), 1}, n_, n_, 1);
+    detail::multiplyParallel(*field_, plan, {packedV.data(), n_}, {inv_.data(), n_},
+                             {z.data(), n_}, 1, n_, n_);
+    uint64_t d = 1;
+    for (size_t i = 0; i < n_; ++i) {
+        d = field_->add(d, field_->mul(packedV[i], w[i]));
+    }
+    if (!apply(w, z, d)) {
+        return false;
+    }
+    detail::forRanges(plan, 0, n_, detail::kRowGrain, n_, [&](size_t from, size_t to) {
+        for (size_t i = from; i < to; ++i) {
+            if (packedU[i] != 0) {
+                detail::axpy(*field_, a_.data() + i * n_, packedV.data(), packedU[i], 0, n_);
+            }
+        }
+    });
+    return true;
+}
+
+bool InverseTracker::replaceRow(size_t i, const std::vector<GFElement>& row) {
+    if (i >= n_) {
+        throw std::out_of_range("Индекс строки вне границ");
+    }
+    // u = e_i, v = row - A[i]: w - столбец i обратной, d = 1 + z[i]
+    std::vector<uint64_t> packed = pack(row);
+    std::vector<uint64_t> v(n_);
+    for (size_t j = 0; j < n_; ++j) {
+        v[j] = field_->sub(packed[j], a_[i * n_ + j]);
+    }
+    std::vector<uint64_t> w(n_);
+    for (size_t k = 0; k < n_; ++k) {
+        w[k] = inv_[k * n_ + i];
+    }
+
+    std::vector<uint64_t> z(n_);
+    detail::multiplyParallel(*field_, planFor(*field_, pool_), {v.data(), n_},
+                             {inv_.data(), n_}, {z.data(), n_}, 1, n_, n_);
+    if (!apply(w, z, field_->add(1, z[i]))) {
+        return false;
+    }
+    std::copy(packed.begin(), packed.end(), a_.begin() + i * n_);
+    return true;
+}
+
+bool InverseTracker::replaceColumn(size_t j, const std::vector<GFElement>& col) {
+    if (j >= n_) {
+        throw std::out_of_range("Индекс столбца вне границ");
+    }
+    // u = col - A[:, j], v = e_j: z - строка j обратной, d = 1 + w[j]
+    std::vector<uint64_t> packed = pack(col);
+    std::vector<uint64_t> u(n_);
+    for (size_t i = 0; i < n_; ++i) {
+        u[i] = field_->sub(packed[i], a_[i * n_ + j]);
+    }
+    std::vector<uint64_t> z(inv_.begin() + j * n_, inv_.begin() + (j + 1) * n_);
+
+    std::vector<uint64_t> w(n_);
+    detail::multiplyParallel(*field_, planFor(*field_, pool_), {inv_.data(), n_},
+                             {u.data(), 1}, {w.data(), 1}, n_, n_, 1);
+    if (!apply(w, z, field_->add(1, w[j]))) {
+        return false;
+    }
+    for (size_t i = 0; i < n_; ++i) {
+        a_[i * n_ + j] = packed[i];
+    }
+    return true;
+}
+
+bool InverseTracker::apply(const std::vector<uint64_t>& w, const std::vector<uint64_t>& z,
+                           uint64_t d) {
+    if (d == 0) {
+        return false;
+    }
+    const Field& field = *field_;
+
+    // A^-1 += (-w / d) z: строки независимы и делятся между потоками
+    uint64_t scale = field.neg(field.inv(d));
+    detail::MultiplyPlan plan = planFor(field, pool_);
+    detail::forRanges(plan, 0, n_, detail::kRowGrain, n_, [&](size_t from, size_t to) {
+        for (size_t i = from; i < to; ++i) {
+            uint64_t f = field.mul(w[i], scale);
+            if (f != 0) {
+                detail::axpy(field, inv_.data() + i * n_, z.data(), f, 0, n_);
+            }
+        }
+    });
+    det_ = field.mul(det_, d);
+    return true;
+}
+
+} // namespace matrix_gf2
@@ -1,76 +1,172 @@
 #include "../include/matrix_gf2/matrix.hpp"
+#include "../include/matrix_gf2/bit_matrix.hpp"
+#include "../include/matrix_gf2/pluq.hpp"
+#include "matrix_multiply.hpp"
+#include "matrix_eliminate.hpp"
+#include <numeric>
 #include <sstream>
 #include <iomanip>
 #include <random>
 #include <algorithm>
+#include <utility>
 
 namespace matrix_gf2 {
 
-Matrix::Matrix(size_t rows, size_t cols, uint32_t p, uint32_t m,
+Matrix::Matrix(size_t rows, size_t cols, uint64_t p, uint32_t m,
                const std::vector<uint32_t>& modulus)
-    : rows_(rows), cols_(cols), p_(p), m_(m), modulus_(modulus) {
-    data_.resize(rows);
-    for (auto& row : data_) {
-        row.resize(cols, GFElement(p, m, modulus));
+    : Matrix(rows, cols, Field::get(p, m, modulus)) {}
+
+namespace {
+
+// Количество элементов GFElement в одной кэш-линии
+constexpr size_t kElementsPerLine = 64 / sizeof(GFElement);
+
+// Шаг между строками, кратный длине кэш-линии
+size_t strideFor(size_t cols) {
+    return (cols + kElementsPerLine - 1) / kElementsPerLine * kElementsPerLine;
+}
+
+// Порядок, начиная с которого обращение выполняется блочно (через дополнение Шура)
+constexpr size_t kBlockInverseThreshold = 128;
+
+// Сторона квадратной плитки при копировании транспонированного представления
+constexpr size_t kTransposeTile = 32;
+
+bool isBinaryField(const Field& field) {
+    return field.p() == 2 && field.m() == 1;
+}
+
+// fn(i, j, value) для всех элементов представления; транспонированное
+// обходится по строкам исходной матрицы плитками, чтобы и чтение, и
+// запись транспонированного результата оставались локальными
+template <typename Fn>
+void forEachElement(const ConstMatrixView& view, Fn fn) {
+    if (!view.isTransposed()) {
+        for (size_t i = 0; i < view.rows(); ++i) {
+            const GFElement* src = view.rowData(i);
+            for (size_t j = 0; j < view.cols(); ++j) {
+                fn(i, j, src[j]);
+            }
+        }
+        return;
+    }
+    for (size_t j0 = 0; j0 < view.cols(); j0 += kTransposeTile) {
+        size_t j1 = std::min(view.cols(), j0 + kTransposeTile);
+        for (size_t i0 = 0; i0 < view.rows(); i0 += kTransposeTile) {
+            size_t i1 = std::min(view.rows(), i0 + kTransposeTile);
+            for (size_t j = j0; j < j1; ++j) {
+                const GFElement* src = view.rowData(j);
+                for (size_t i = i0; i < i1; ++i) {
+                    fn(i, j, src[i]);
+                }
+            }
+        }
     }
 }
 
+// Упакованные значения представления (построчно, без выравнивания)
+std::vector<uint64_t> packValues(const ConstMatrixView& view) {
+    size_t cols = view.cols();
+    std::vector<uint64_t> values(view.rows() * cols);
+    forEachElement(view, [&](size_t i, size_t j, const GFElement& e) {
+        values[i * cols + j] = e.raw();
+    });
+    return values;
+}
+
+// Запись упакованных значений в матрицу
+void unpackValues(Matrix& mat, const uint64_t* values) {
+    const Field& field = mat.field();
+    for (size_t i = 0; i < mat.rows(); ++i) {
+        GFElement* dest = mat.rowData(i);
+        for (size_t j = 0; j < mat.cols(); ++j) {
+            dest[j] = GFElement::fromRaw(field, values[i * mat.cols() + j]);
+        }
+    }
+}
+
+// result(i, j) = op(a(i, j), b(i, j))
+template <typename Op>
+Matrix combine(const ConstMatrixView& a, const ConstMatrixView& b, Op op) {
+    if (a.rows() != b.rows() || a.cols() != b.cols()) {
+        throw std::invalid_argument("Размеры матриц не совпадают");
+    }
+    Matrix result(a);
+    forEachElement(b, [&](size_t i, size_t j, const GFElement& e) {
+        GFElement& dest = result.rowData(i)[j];
+        dest = op(dest, e);
+    });
+    return result;
+}
+
+} // namespace
+
+Matrix::Matrix(size_t rows, size_t cols, const Field& field)
+    : rows_(rows), cols_(cols), stride_(strideFor(cols)), field_(&field),
+      data_(rows * stride_, GFElement(field)), rowIndex_(rows) {
+    std::iota(rowIndex_.begin(), rowIndex_.end(), size_t(0));
+}
+
 Matrix::Matrix(const std::vector<std::vector<uint32_t>>& data,
-               uint32_t p, uint32_t m,
+               uint64_t p, uint32_t m,
                const std::vector<uint32_t>& modulus)
-    : rows_(data.size()), cols_(data.empty() ? 0 : data[0].size()),
-      p_(p), m_(m), modulus_(modulus) {
-    
-    data_.resize(rows_);
+    : Matrix(data.size(), data.empty() ? 0 : data[0].size(),
+             Field::get(p, m, modulus)) {
     for (size_t i = 0; i < rows_; ++i) {
-        data_[i].resize(cols_);
         for (size_t j = 0; j < cols_ && j < data[i].size(); ++j) {
-            data_[i][j] = GFElement(data[i][j], p, m, modulus);
+            rowData(i)[j] = GFElement(*field_, data[i][j]);
         }
     }
 }
 
 Matrix::Matrix(const std::vector<std::vector<GFElement>>& data)
-    : rows_(data.size()), cols_(data.empty() ? 0 : data[0].size()) {
-    
-    if (!data.empty() && !data[0].empty()) {
-        p_ = data[0][0].getP();
-        m_ = data[0][0].getM();
-        modulus_ = {1, 1};  // Значение по умолчанию
+    : Matrix(data.size(), data.empty() ? 0 : data[0].size(),
+             data.empty() || data[0].empty() ? Field::get(2) : data[0][0].field()) {
+    for (size_t i = 0; i < rows_; ++i) {
+        std::copy(data[i].begin(), data[i].begin() + std::min(cols_, data[i].size()),
+                  rowData(i));
     }
-    
-    data_ = data;
 }
 
-Matrix Matrix::identity(size_t n, uint32_t p, uint32_t m,
+Matrix::Matrix(const ConstMatrixView& view)
+    : Matrix(view.rows(), view.cols(), view.field()) {
+    if (!view.isTransposed()) {
+        for (size_t i = 0; i < rows_; ++i) {
+            std::copy(view.rowData(i), view.rowData(i) + cols_, rowData(i));
+        }
+        return;
+    }
+    forEachElement(view, [this](size_t i, size_t j, const GFElement& e) {
+        rowData(i)[j] = e;
+    });
+}
+
+Matrix Matrix::identity(size_t n, uint64_t p, uint32_t m,
                        const std::vector<uint32_t>& modulus) {
     Matrix result(n, n, p, m, modulus);
     for (size_t i = 0; i < n; ++i) {
-        result.data_[i][i] = GFElement(1, p, m, modulus);
+        result.rowData(i)[i] = GFElement(*result.field_, 1);
     }
     return result;
 }
 
-Matrix Matrix::zero(size_t rows, size_t cols, uint32_t p, uint32_t m,
+Matrix Matrix::zero(size_t rows, size_t cols, uint64_t p, uint32_t m,
                    const std::vector<uint32_t>& modulus) {
     return Matrix(rows, cols, p, m, modulus);
 }
 
-Matrix Matrix::random(size_t rows, size_t cols, uint32_t p, uint32_t m,
+Matrix Matrix::random(size_t rows, size_t cols, uint64_t p, uint32_t m,
                      const std::vector<uint32_t>& modulus) {
     Matrix result(rows, cols, p, m, modulus);
     std::random_device rd;
-    std::mt19937 gen(rd());
+    std::mt19937_64 gen(rd());
     
-    uint32_t max_val = 1;
-    for (uint32_t i = 0; i < m; ++i) {
-        max_val *= p;
-    }
-    std::uniform_int_distribution<uint32_t> dis(0, max_val - 1);
+    const Field& field = *result.field_;
+    std::uniform_int_distribution<uint64_t> dis(0, field.maxValue());
     
     for (size_t i = 0; i < rows; ++i) {
         for (size_t j = 0; j < cols; ++j) {
-            result.data_[i][j] = GFElement(dis(gen), p, m, modulus);
+            result.rowData(i)[j] = GFElement::fromRaw(field, dis(gen));
         }
     }
     return result;
@@ -80,68 +176,144 @@ GFElement& Matrix::at(size_t i, size_t j) {
     if (i >= rows_ || j >= cols_) {
         throw std::out_of_range("Индекс вне границ матрицы");
     }
-    return data_[i][j];
+    return rowData(i)[j];
 }
 
 const GFElement& Matrix::at(size_t i, size_t j) const {
     if (i >= rows_ || j >= cols_) {
         throw std::out_of_range("Индекс вне границ матрицы");
     }
-    return data_[i][j];
+    return rowData(i)[j];
 }
 
-GFElement& Matrix::operator()(size_t i, size_t j) {
-    return at(i, j);
+RowView Matrix::row(size_t i) {
+    if (i >= rows_) {
+        throw std::out_of_range("Индекс строки вне границ");
+    }
+    return RowView(rowData(i), cols_);
 }
 
-const GFElement& Matrix::operator()(size_t i, size_t j) const {
-    return at(i, j);
+ConstRowView Matrix::row(size_t i) const {
+    if (i >= rows_) {
+        throw std::out_of_range("Индекс строки вне границ");
+    }
+    return ConstRowView(rowData(i), cols_);
 }
 
-Matrix Matrix::operator+(const Matrix& other) const {
-    if (rows_ != other.rows_ || cols_ != other.cols_) {
-        throw std::invalid_argument("Размеры матриц не совпадают");
+ColumnView Matrix::col(size_t j) {
+    if (j >= cols_) {
+        throw std::out_of_range("Индекс столбца вне границ");
     }
-    
-    Matrix result(rows_, cols_, p_, m_, modulus_);
-    for (size_t i = 0; i < rows_; ++i) {
-        for (size_t j = 0; j < cols_; ++j) {
-            result.data_[i][j] = data_[i][j] + other.data_[i][j];
-        }
+    return ColumnView(*this, 0, j, rows_);
+}
+
+ConstColumnView Matrix::col(size_t j) const {
+    if (j >= cols_) {
+        throw std::out_of_range("Индекс столбца вне границ");
     }
-    return result;
+    return ConstColumnView(*this, 0, j, rows_);
 }
 
-Matrix Matrix::operator-(const Matrix& other) const {
-    if (rows_ != other.rows_ || cols_ != other.cols_) {
-        throw std::invalid_argument("Размеры матриц не совпадают");
+MatrixView Matrix::block(size_t row0, size_t col0, size_t rows, size_t cols) {
+    return view().block(row0, col0, rows, cols);
+}
+
+ConstMatrixView Matrix::block(size_t row0, size_t col0, size_t rows, size_t cols) const {
+    return view().block(row0, col0, rows, cols);
+}
+
+MatrixView Matrix::view() {
+    return MatrixView(*this);
+}
+
+ConstMatrixView Matrix::view() const {
+    return ConstMatrixView(*this);
+}
+
+Matrix operator+(const ConstMatrixView& a, const ConstMatrixView& b) {
+    return combine(a, b, [](const GFElement& x, const GFElement& y) { return x + y; });
+}
+
+Matrix operator-(const ConstMatrixView& a, const ConstMatrixView& b) {
+    return combine(a, b, [](const GFElement& x, const GFElement& y) { return x - y; });
+}
+
+Matrix operator*(const ConstMatrixView& a, const ConstMatrixView& b) {
+    return multiply(a, b);
+}
+
+Matrix multiply(const ConstMatrixView& a, const ConstMatrixView& b,
+                const MultiplyOptions& options) {
+    if (a.cols() != b.rows()) {
+        throw std::invalid_argument("Несовместимые размеры для умножения матриц");
     }
     
-    Matrix result(rows_, cols_, p_, m_, modulus_);
-    for (size_t i = 0; i < rows_; ++i) {
-        for (size_t j = 0; j < cols_; ++j) {
-            result.data_[i][j] = data_[i][j] - other.data_[i][j];
-        }
+    const Field& field = a.field();
+    if (&field != &b.field()) {
+        throw std::invalid_argument("Матрицы над разными полями");
     }
+    
+    if (isBinaryField(field)) {
+        return (BitMatrix::fromMatrix(a) * BitMatrix::fromMatrix(b)).toMatrix();
+    }
+    
+    // Арифметика выполняется над упакованными значениями контекста поля
+    std::vector<uint64_t> packedA = packValues(a);
+    std::vector<uint64_t> packedB = packValues(b);
+    std::vector<uint64_t> c(a.rows() * b.cols());
+    detail::multiplyParallel(field, detail::planMultiply(field, options),
+                             {packedA.data(), a.cols()}, {packedB.data(), b.cols()},
+                             {c.data(), b.cols()}, a.rows(), a.cols(), b.cols());
+    
+    Matrix result(a.rows(), b.cols(), field);
+    unpackValues(result, c.data());
     return result;
 }
 
-Matrix Matrix::operator*(const Matrix& other) const {
-    if (cols_ != other.rows_) {
-        throw std::invalid_argument("Несовместимые размеры для умножения матриц");
+std::vector<GFElement> operator*(const ConstMatrixView& a, const std::vector<GFElement>& vec) {
+    if (vec.size() != a.cols()) {
+        throw std::invalid_argument("Размер вектора не совпадает с количеством столбцов");
     }
     
-    Matrix result(rows_, other.cols_, p_, m_, modulus_);
-    for (size_t i = 0; i < rows_; ++i) {
-        for (size_t j = 0; j < other.cols_; ++j) {
-            GFElement sum(p_, m_, modulus_);
-            for (size_t k = 0; k < cols_; ++k) {
-                sum += data_[i][k] * other.data_[k][j];
+    std::vector<GFElement> result(a.rows(), GFElement(a.field()));
+    forEachElement(a, [&](size_t i, size_t j, const GFElement& e) {
+        result[i] += e * vec[j];
+    });
+    return result;
+}
+
+bool operator==(const ConstMatrixView& a, const ConstMatrixView& b) {
+    if (a.rows() != b.rows() || a.cols() != b.cols()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.rows(); ++i) {
+        for (size_t j = 0; j < a.cols(); ++j) {
+            if (a(i, j) != b(i, j)) {
+                return false;
             }
-            result.data_[i][j] = sum;
         }
     }
-    return result;
+    return true;
+}
+
+bool operator!=(const ConstMatrixView& a, const ConstMatrixView& b) {
+    return !(a == b);
+}
+
+Matrix Matrix::operator+(const Matrix& other) const {
+    return view() + other.view();
+}
+
+Matrix Matrix::operator-(const Matrix& other) const {
+    return view() - other.view();
+}
+
+Matrix Matrix::operator*(const Matrix& other) const {
+    return multiply(other);
+}
+
+Matrix Matrix::multiply(const Matrix& other, const MultiplyOptions& options) const {
+    return matrix_gf2::multiply(*this, other, options);
 }
 
 Matrix& Matrix::operator+=(const Matrix& other) {
@@ -155,10 +327,10 @@ Matrix& Matrix::operator-=(const Matrix& other) {
 }
 
 Matrix Matrix::operator*(const GFElement& scalar) const {
-    Matrix result(rows_, cols_, p_, m_, modulus_);
+    Matrix result(rows_, cols_, *field_);
     for (size_t i = 0; i < rows_; ++i) {
         for (size_t j = 0; j < cols_; ++j) {
-            result.data_[i][j] = data_[i][j] * scalar;
+            result.rowData(i)[j] = rowData(i)[j] * scalar;
         }
     }
     return result;
@@ -170,47 +342,19 @@ Matrix& Matrix::operator*=(const GFElement& scalar) {
 }
 
 std::vector<GFElement> Matrix::operator*(const std::vector<GFElement>& vec) const {
-    if (vec.size() != cols_) {
-        throw std::invalid_argument("Размер вектора не совпадает с количеством столбцов");
-    }
-    
-    std::vector<GFElement> result(rows_, GFElement(p_, m_, modulus_));
-    for (size_t i = 0; i < rows_; ++i) {
-        GFElement sum(p_, m_, modulus_);
-        for (size_t j = 0; j < cols_; ++j) {
-            sum += data_[i][j] * vec[j];
-        }
-        result[i] = sum;
-    }
-    return result;
+    return view() * vec;
 }
 
 Matrix Matrix::transpose() const {
-    Matrix result(cols_, rows_, p_, m_, modulus_);
-    for (size_t i = 0; i < rows_; ++i) {
-        for (size_t j = 0; j < cols_; ++j) {
-            result.data_[j][i] = data_[i][j];
-        }
-    }
-    return result;
+    return Matrix(view().transposed());
 }
 
 std::vector<GFElement> Matrix::getRow(size_t i) const {
-    if (i >= rows_) {
-        throw std::out_of_range("Индекс строки вне границ");
-    }
-    return data_[i];
+    return row(i).toVector();
 }
 
 std::vector<GFElement> Matrix::getCol(size_t j) const {
-    if (j >= cols_) {
-        throw std::out_of_range("Индекс столбца вне границ");
-    }
-    std::vector<GFElement> col(rows_);
-    for (size_t i = 0; i < rows_; ++i) {
-        col[i] = data_[i][j];
-    }
-    return col;
+    return col(j).toVector();
 }
 
 void Matrix::setRow(size_t i, const std::vector<GFElement>& row) {
@@ -220,7 +364,7 @@ void Matrix::setRow(size_t i, const std::vector<GFElement>& row) {
     if (row.size() != cols_) {
         throw std::invalid_argument("Размер строки не совпадает");
     }
-    data_[i] = row;
+    std::copy(row.begin(), row.end(), rowData(i));
 }
 
 void Matrix::setCol(size_t j, const std::vector<GFElement>& col) {
@@ -231,7 +375,7 @@ void Matrix::setCol(size_t j, const std::vector<GFElement>& col) {
         throw std::invalid_argument("Размер столбца не совпадает");
     }
     for (size_t i = 0; i < rows_; ++i) {
-        data_[i][j] = col[i];
+        rowData(i)[j] = col[i];
     }
 }
 
@@ -239,15 +383,19 @@ void Matrix::swapRows(size_t i, size_t j) {
     if (i >= rows_ || j >= rows_) {
         throw std::out_of_range("Индекс строки вне границ");
     }
-    std::swap(data_[i], data_[j]);
+    // Переставляются только индексы физических строк
+    std::swap(rowIndex_[i], rowIndex_[j]);
 }
 
 void Matrix::multiplyRow(size_t i, const GFElement& scalar) {
     if (i >= rows_) {
         throw std::out_of_range("Индекс строки вне границ");
     }
+    const Field& field = *field_;
+    uint64_t s = scalar.raw();
+    GFElement* row = rowData(i);
     for (size_t j = 0; j < cols_; ++j) {
-        data_[i][j] *= scalar;
+        row[j] = GFElement::fromRaw(field, field.mul(row[j].raw(), s));
     }
 }
 
@@ -255,14 +403,21 @@ void Matrix::addRow(size_t dest, size_t src, const GFElement& scalar) {
     if (dest >= rows_ || src >= rows_) {
         throw std::out_of_range("Индекс строки вне границ");
     }
+    const Field& field = *field_;
+    uint64_t s = scalar.raw();
+    if (s == 0) {
+        return;
+    }
+    GFElement* d = rowData(dest);
+    const GFElement* r = rowData(src);
     for (size_t j = 0; j < cols_; ++j) {
-        data_[dest][j] += data_[src][j] * scalar;
+        d[j] = GFElement::fromRaw(field, field.add(d[j].raw(), field.mul(r[j].raw(), s)));
     }
 }
 
 std::optional<size_t> Matrix::findPivot(const Matrix& mat, size_t col, size_t startRow) const {
     for (size_t i = startRow; i < mat.rows_; ++i) {
-        if (!mat.data_[i][col].isZero()) {
+        if (!mat.rowData(i)[col].isZero()) {
             return i;
         }
     }
@@ -281,7 +436,47 @@ GaussResult Matrix::reducedRowEchelonForm(bool educational) const {
     return gaussElimination(true, true, educational);
 }
 
+GaussResult Matrix::forwardGauss(const EliminationOptions& options) const {
+    return blockedElimination(false, options);
+}
+
+GaussResult Matrix::reducedRowEchelonForm(const EliminationOptions& options) const {
+    return blockedElimination(true, options);
+}
+
+GaussResult Matrix::blockedElimination(bool backward, const EliminationOptions& options) const {
+    if (isBinary()) {
+        return gaussElimination(true, backward, false);
+    }
+    
+    MultiplyOptions multiplyOptions;
+    multiplyOptions.pool = options.pool;
+    std::vector<uint64_t> values = packValues(*this);
+    std::vector<size_t> pivots = detail::eliminateBlocked(
+        *field_, detail::planMultiply(*field_, multiplyOptions), {values.data(), cols_},
+        rows_, cols_, backward);
+    
+    Matrix reduced(rows_, cols_, *field_);
+    unpackValues(reduced, values.data());
+    GaussResult result(std::move(reduced));
+    result.rank = pivots.size();
+    result.pivotCols = std::move(pivots);
+    return result;
+}
+
 GaussResult Matrix::gaussElimination(bool forward, bool backward, bool educational) const {
+    // Над GF(2) без учебного режима - упакованное исключение M4RI
+    // (результат совпадает с поэлементным алгоритмом ниже)
+    if (forward && !educational && isBinary()) {
+        BitMatrix packed = BitMatrix::fromMatrix(*this);
+        BitGaussResult bitResult = backward ? packed.reducedRowEchelonForm()
+                                            : packed.forwardGauss();
+        GaussResult result(bitResult.matrix.toMatrix());
+        result.rank = bitResult.rank;
+        result.pivotCols = std::move(bitResult.pivotCols);
+        return result;
+    }
+    
     GaussResult result(*this);  // Use the constructor
     
     size_t currentRow = 0;
@@ -316,7 +511,7 @@ GaussResult Matrix::gaussElimination(bool forward, bool backward, bool education
             result.pivotCols.push_back(col);
             
             // Нормализация строки
-            GFElement pivot = result.matrix.data_[currentRow][col];
+            GFElement pivot = result.matrix.rowData(currentRow)[col];
             if (!pivot.isOne()) {
                 GFElement pivotInv = pivot.inverse();
                 result.matrix.multiplyRow(currentRow, pivotInv);
@@ -331,8 +526,8 @@ GaussResult Matrix::gaussElimination(bool forward, bool backward, bool education
             
             // Обнуление элементов ниже ведущего
             for (size_t row = currentRow + 1; row < rows_; ++row) {
-                if (!result.matrix.data_[row][col].isZero()) {
-                    GFElement factor = -result.matrix.data_[row][col];
+                if (!result.matrix.rowData(row)[col].isZero()) {
+                    GFElement factor = -result.matrix.rowData(row)[col];
                     result.matrix.addRow(row, currentRow, factor);
                     if (educational) {
                         std::ostringstream oss;
@@ -366,7 +561,7 @@ GaussResult Matrix::gaussElimination(bool forward, bool backward, bool education
             result.pivotCols.clear();
             for (size_t row = 0; row < rows_; ++row) {
                 for (size_t col = 0; col < cols_; ++col) {
-                    if (!result.matrix.data_[row][col].isZero()) {
+                    if (!result.matrix.rowData(row)[col].isZero()) {
                         result.pivotCols.push_back(col);
                         result.rank++;
                         break;
@@ -382,8 +577,8 @@ GaussResult Matrix::gaussElimination(bool forward, bool backward, bool education
             size_t pivotCol = result.pivotCols[pivotIdx];
             
             for (int row = static_cast<int>(pivotRow) - 1; row >= 0; --row) {
-                if (!result.matrix.data_[row][pivotCol].isZero()) {
-                    GFElement factor = -result.matrix.data_[row][pivotCol];
+                if (!result.matrix.rowData(row)[pivotCol].isZero()) {
+                    GFElement factor = -result.matrix.rowData(row)[pivotCol];
                     result.matrix.addRow(row, pivotRow, factor);
                     if (educational) {
                         std::ostringstream oss;
@@ -406,10 +601,20 @@ GaussResult Matrix::gaussElimination(bool forward, bool backward, bool education
 }
 
 size_t Matrix::rank() const {
+    if (isBinary()) {
+        return BitMatrix::fromMatrix(*this).rank();
+    }
     auto result = forwardGauss(false);
     return result.rank;
 }
 
+size_t Matrix::rank(const EliminationOptions& options) const {
+    if (isBinary()) {
+        return BitMatrix::fromMatrix(*this).rank();
+    }
+    return forwardGauss(options).rank;
+}
+
 bool Matrix::isInvertible() const {
     if (rows_ != cols_) {
         return false;
@@ -425,17 +630,159 @@ std::optional<Matrix> Matrix::inverse(bool educational) const {
         return std::nullopt;
     }
     
+    if (!educational && isBinary()) {
+        auto inv = BitMatrix::fromMatrix(*this).inverse();
+        if (!inv) {
+            return std::nullopt;
+        }
+        return inv->toMatrix();
+    }
+    
+    if (!educational && rows_ >= kBlockInverseThreshold) {
+        return blockInverse(MultiplyOptions());
+    }
+    
+    return inverseGaussJordan(educational);
+}
+
+std::optional<Matrix> Matrix::inverse(const EliminationOptions& options) const {
+    if (rows_ != cols_) {
+        return std::nullopt;
+    }
+    
+    if (isBinary()) {
+        return inverse(false);
+    }
+    
+    if (rows_ >= kBlockInverseThreshold) {
+        MultiplyOptions multiplyOptions;
+        multiplyOptions.pool = options.pool;
+        return blockInverse(multiplyOptions, &options);
+    }
+    
+    return inverseGaussJordan(false, &options);
+}
+
+std::optional<Matrix> Matrix::blockInverse(const MultiplyOptions& options,
+                                           const EliminationOptions* elimination) const {
+    // M = [A B; C D], S = D - C A^{-1} B (дополнение Шура):
+    // M^{-1} = [A^{-1} + A^{-1} B S^{-1} C A^{-1}, -A^{-1} B S^{-1}; -S^{-1} C A^{-1}, S^{-1}]
+    size_t h = rows_ / 2;
+    size_t rest = rows_ - h;
+    Matrix a(block(0, 0, h, h));
+    auto aInv = elimination ? a.inverse(*elimination) : a.inverse();
+    if (!aInv) {
+        // Левый верхний блок вырожден - обычный метод Гаусса-Жордана
+        return inverseGaussJordan(false, elimination);
+    }
+    
+    ConstMatrixView b = block(0, h, h, rest);
+    ConstMatrixView c = block(h, 0, rest, h);
+    ConstMatrixView d = block(h, h, rest, rest);
+    
+    Matrix cAinv = matrix_gf2::multiply(c, *aInv, options);
+    Matrix schur = d - matrix_gf2::multiply(cAinv, b, options);
+    auto schurInv = elimination ? schur.inverse(*elimination) : schur.inverse();
+    if (!schurInv) {
+        // det M = det A * det S
+        return std::nullopt;
+    }
+    
+    Matrix zero12(h, rest, *field_);
+    Matrix zero21(rest, h, *field_);
+    Matrix t = matrix_gf2::multiply(*aInv, b, options).multiply(*schurInv, options);
+    
+    Matrix result(rows_, cols_, *field_);
+    result.block(0, 0, h, h).assign(*aInv + t.multiply(cAinv, options));
+    result.block(0, h, h, rest).assign(zero12 - t);
+    result.block(h, 0, rest, h).assign(zero21 - schurInv->multiply(cAinv, options));
+    result.block(h, h, rest, rest).assign(*schurInv);
+    return result;
+}
+
+bool Matrix::invertInPlace() {
+    if (rows_ != cols_) {
+        return false;
+    }
+    
+    if (isBinary()) {
+        auto inv = BitMatrix::fromMatrix(*this).inverse();
+        if (!inv) {
+            return false;
+        }
+        *this = inv->toMatrix();
+        return true;
+    }
+    
+    const Field& field = *field_;
+    size_t n = rows_;
+    std::vector<size_t> pivotRows(n);
+    for (size_t k = 0; k < n; ++k) {
+        size_t r = k;
+        while (r < n && rowData(r)[k].isZero()) {
+            ++r;
+        }
+        if (r == n) {
+            return false;
+        }
+        pivotRows[k] = r;
+        std::swap(rowIndex_[k], rowIndex_[r]);
+        
+        // Столбец k больше не нужен: в нём накапливается столбец обратной
+        GFElement* pivot = rowData(k);
+        uint64_t inv = field.inv(pivot[k].raw());
+        pivot[k] = GFElement::fromRaw(field, 1);
+        for (size_t j = 0; j < n; ++j) {
+            pivot[j] = GFElement::fromRaw(field, field.mul(pivot[j].raw(), inv));
+        }
+        for (size_t i = 0; i < n; ++i) {
+            GFElement* row = rowData(i);
+            uint64_t f = row[k].raw();
+            if (i == k || f == 0) {
+                continue;
+            }
+            f = field.neg(f);
+            row[k] = GFElement(field);
+            for (size_t j = 0; j < n; ++j) {
+                row[j] = GFElement::fromRaw(field, field.add(row[j].raw(),
+                                                             field.mul(f, pivot[j].raw())));
+            }
+        }
+    }
+    
+    // (P A)^{-1} = A^{-1} P^{-1}: перестановки строк отменяются
+    // перестановками столбцов в обратном порядке
+    for (size_t k = n; k-- > 0;) {
+        if (pivotRows[k] != k) {
+            for (size_t i = 0; i < n; ++i) {
+                std::swap(rowData(i)[k], rowData(i)[pivotRows[k]]);
+            }
+        }
+    }
+    return true;
+}
+
+std::optional<Matrix> Matrix::inverseGaussJordan(bool educational,
+                                                 const EliminationOptions* options) const {
+    if (!educational && !options) {
+        Matrix inv = *this;
+        if (!inv.invertInPlace()) {
+            return std::nullopt;
+        }
+        return inv;
+    }
+    
     // Создаём расширенную матрицу [A | I]
-    Matrix augmented(rows_, 2 * cols_, p_, m_, modulus_);
+    Matrix augmented(rows_, 2 * cols_, *field_);
     for (size_t i = 0; i < rows_; ++i) {
         for (size_t j = 0; j < cols_; ++j) {
-            augmented.data_[i][j] = data_[i][j];
+            augmented.rowData(i)[j] = rowData(i)[j];
         }
         for (size_t j = 0; j < cols_; ++j) {
             if (i == j) {
-                augmented.data_[i][cols_ + j] = GFElement(1, p_, m_, modulus_);
+                augmented.rowData(i)[cols_ + j] = GFElement(*field_, 1);
             } else {
-                augmented.data_[i][cols_ + j] = GFElement(p_, m_, modulus_);
+                augmented.rowData(i)[cols_ + j] = GFElement(*field_);
             }
         }
     }
@@ -445,7 +792,8 @@ std::optional<Matrix> Matrix::inverse(bool educational) const {
     }
     
     // Приводим к RREF
-    auto result = augmented.reducedRowEchelonForm(educational);
+    auto result = options ? augmented.reducedRowEchelonForm(*options)
+                          : augmented.reducedRowEchelonForm(educational);
     
     if (educational) {
         std::cout << "\nПосле приведения к RREF:\n" << result.matrix << "\n";
@@ -458,8 +806,8 @@ std::optional<Matrix> Matrix::inverse(bool educational) const {
     for (size_t i = 0; i < rows_; ++i) {
         for (size_t j = 0; j < cols_; ++j) {
             bool shouldBeOne = (i == j);
-            bool isOne = result.matrix.data_[i][j].isOne();
-            bool isZero = result.matrix.data_[i][j].isZero();
+            bool isOne = result.matrix.rowData(i)[j].isOne();
+            bool isZero = result.matrix.rowData(i)[j].isZero();
             
             if (shouldBeOne && !isOne) {
                 if (educational) {
@@ -477,10 +825,10 @@ std::optional<Matrix> Matrix::inverse(bool educational) const {
     }
     
     // Извлекаем правую часть (обратную матрицу)
-    Matrix inv(rows_, cols_, p_, m_, modulus_);
+    Matrix inv(rows_, cols_, *field_);
     for (size_t i = 0; i < rows_; ++i) {
         for (size_t j = 0; j < cols_; ++j) {
-            inv.data_[i][j] = result.matrix.data_[i][cols_ + j];
+            inv.rowData(i)[j] = result.matrix.rowData(i)[cols_ + j];
         }
     }
     
@@ -491,81 +839,38 @@ std::optional<Matrix> Matrix::inverse(bool educational) const {
     return inv;
 }
 
-std::optional<SubmatrixInfo> Matrix::findInvertibleSubmatrix() const {
-    size_t maxSize = std::min(rows_, cols_);
-    
-    // Пробуем найти обратимую подматрицу максимального размера
-    for (size_t size = maxSize; size >= 1; --size) {
-        // Пробуем все комбинации строк
-        std::vector<size_t> rowIndices;
-        for (size_t i = 0; i < rows_; ++i) {
-            rowIndices.push_back(i);
-        }
-        
-        // Генерируем комбинации строк
-        std::vector<bool> rowSelector(rows_, false);
-        std::fill(rowSelector.begin(), rowSelector.begin() + size, true);
-        
-        do {
-            std::vector<size_t> selectedRows;
-            for (size_t i = 0; i < rows_; ++i) {
-                if (rowSelector[i]) {
-                    selectedRows.push_back(i);
-                }
-            }
-            
-            // Генерируем комбинации столбцов
-            std::vector<bool> colSelector(cols_, false);
-            std::fill(colSelector.begin(), colSelector.begin() + size, true);
-            
-            do {
-                std::vector<size_t> selectedCols;
-                for (size_t j = 0; j < cols_; ++j) {
-                    if (colSelector[j]) {
-                        selectedCols.push_back(j);
-                    }
-                }
-                
-                // Проверяем подматрицу
-                Matrix sub = submatrix(selectedRows, selectedCols);
-                if (sub.isInvertible()) {
-                    SubmatrixInfo info(sub);
-                    info.rows = selectedRows;
-                    info.cols = selectedCols;
-                    return info;
-                }
-                
-            } while (std::prev_permutation(colSelector.begin(), colSelector.end()));
-            
-        } while (std::prev_permutation(rowSelector.begin(), rowSelector.end()));
+std::optional<SubmatrixInfo> Matrix::findInvertibleSubmatrix(const EliminationOptions& options) const {
+    // Максимальный размер обратимой подматрицы - ранг. Первые независимые
+    // строки (профиль ранга по строкам) образуют базис пространства строк,
+    // поэтому зависимости столбцов подматрицы из этих строк те же, что у A:
+    // её первые независимые столбцы - профиль ранга A по столбцам. Это
+    // лексикографически первая пара наборов, как при полном переборе
+    PLUQ factors = pluq(options);
+    if (factors.rank() == 0) {
+        return std::nullopt;
     }
     
-    return std::nullopt;
+    std::vector<size_t> selectedRows = factors.rowRankProfile();
+    std::vector<size_t> selectedCols = factors.columnRankProfile();
+    SubmatrixInfo info(submatrix(selectedRows, selectedCols));
+    info.rows = std::move(selectedRows);
+    info.cols = std::move(selectedCols);
+    return info;
 }
 
 Matrix Matrix::submatrix(const std::vector<size_t>& rowIndices,
                         const std::vector<size_t>& colIndices) const {
-    Matrix result(rowIndices.size(), colIndices.size(), p_, m_, modulus_);
+    Matrix result(rowIndices.size(), colIndices.size(), *field_);
     for (size_t i = 0; i < rowIndices.size(); ++i) {
         for (size_t j = 0; j < colIndices.size(); ++j) {
-            result.data_[i][j] = data_[rowIndices[i]][colIndices[j]];
+            result.rowData(i)[j] = rowData(rowIndices[i])[colIndices[j]];
         }
     }
     return result;
 }
 
 bool Matrix::operator==(const Matrix& other) const {
-    if (rows_ != other.rows_ || cols_ != other.cols_) {
-        return false;
-    }
-    for (size_t i = 0; i < rows_; ++i) {
-        for (size_t j = 0; j < cols_; ++j) {
-            if (data_[i][j] != other.data_[i][j]) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return view() == other.view();
 }
 
 bool Matrix::operator!=(const Matrix& other) const {
@@ -583,7 +888,7 @@ std::ostream& operator<<(std::ostream& os, const Matrix& mat) {
         os << "[";
         for (size_t j = 0; j < mat.cols_; ++j) {
             if (j > 0) os << " ";
-            os << std::setw(4) << mat.data_[i][j];
+            os << std::setw(4) << mat.rowData(i)[j];
         }
         os << " ]";
         if (i < mat.rows_ - 1) os << "\n";
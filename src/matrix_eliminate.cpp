@@ -0,0 +1,203 @@
+#include "matrix_eliminate.hpp"
+#include "../include/matrix_gf2/thread_pool.hpp"
+#include <algorithm>
+#include <functional>
+
+namespace matrix_gf2 {
+namespace detail {
+
+namespace {
+
+// Ширина панели столбцов (и блока ведущих строк обратного хода) - глубина
+// умножения C += F * T при обновлении остатка матрицы
+constexpr size_t kPanelWidth = 64;
+
+// Диапазон индексов делится между потоками от kParallelWork операций;
+// каждая задача обрабатывает не меньше kColumnGrain столбцов
+constexpr size_t kParallelWork = size_t(1) << 16;
+constexpr size_t kColumnGrain = 256;
+
+// row[j] *= f, from <= j < to
+void scale(const Field& field, uint64_t* row, uint64_t f, size_t from, size_t to) {
+    for (size_t j = from; j < to; ++j) {
+        row[j] = field.mul(row[j], f);
+    }
+}
+
+} // namespace
+
+void forRanges(const MultiplyPlan& plan, size_t first, size_t last, size_t grain,
+               size_t work, const std::function<void(size_t, size_t)>& fn) {
+    if (first >= last) {
+        return;
+    }
+    size_t count = last - first;
+    if (count <= grain || count * work < kParallelWork) {
+        fn(first, last);
+        return;
+    }
+    ThreadPool& pool = plan.pool ? *plan.pool : ThreadPool::global();
+    if (pool.size() == 1) {
+        fn(first, last);
+        return;
+    }
+    size_t tasks = std::min((count + grain - 1) / grain, pool.size() * 4);
+    size_t chunk = (count + tasks - 1) / tasks;
+    pool.parallelFor((count + chunk - 1) / chunk, [&](size_t t) {
+        size_t from = first + t * chunk;
+        fn(from, std::min(last, from + chunk));
+    });
+}
+
+std::vector<size_t> eliminateBlocked(const Field& field, const MultiplyPlan& plan, Block a,
+                                     size_t rows, size_t cols, bool backward,
+                                     EliminationFactors* lu) {
+    std::vector<size_t> pivots;
+    std::vector<uint64_t> factors;
+    size_t cur = 0;
+    if (lu) {
+        lu->rowOrder.resize(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            lu->rowOrder[i] = i;
+        }
+        lu->pivotValues.clear();
+    }
+
+    for (size_t c0 = 0; c0 < cols && cur < rows; c0 += kPanelWidth) {
+        size_t c1 = std::min(cols, c0 + kPanelWidth);
+        size_t first = cur;
+        size_t firstPivot = pivots.size();
+        std::vector<uint64_t> inverses;
+
+        // Исключение внутри панели; множитель строки r для ведущего столбца
+        // col сохраняется на месте a[r][col]
+        for (size_t col = c0; col < c1 && cur < rows; ++col) {
+            size_t r = cur;
+            while (r < rows && a.row(r)[col] == 0) {
+                ++r;
+            }
+            if (r == rows) {
+                continue;
+            }
+            if (r != cur) {
+                std::swap_ranges(a.row(r), a.row(r) + cols, a.row(cur));
+                if (lu) {
+                    std::swap(lu->rowOrder[r], lu->rowOrder[cur]);
+                }
+            }
+
+            uint64_t* pivotRow = a.row(cur);
+            if (lu) {
+                lu->pivotValues.push_back(pivotRow[col]);
+            }
+            uint64_t inv = field.inv(pivotRow[col]);
+            scale(field, pivotRow, inv, col + 1, c1);
+            pivotRow[col] = 1;
+            inverses.push_back(inv);
+
+            forRanges(plan, cur + 1, rows, kRowGrain, c1 - col, [&](size_t from, size_t to) {
+                for (size_t i = from; i < to; ++i) {
+                    uint64_t* row = a.row(i);
+                    if (row[col] != 0) {
+                        uint64_t f = field.neg(row[col]);
+                        axpy(field, row, pivotRow, f, col + 1, c1);
+                        row[col] = f;
+                    }
+                }
+            });
+
+            pivots.push_back(col);
+            ++cur;
+        }
+
+        size_t w = cur - first;
+        if (w > 0 && c1 < cols) {
+            // Ведущие строки панели справа от неё: T_j = (T_j + sum f_ji T_i) * inv_j
+            forRanges(plan, c1, cols, kColumnGrain, w * w, [&](size_t from, size_t to) {
+                for (size_t j = 0; j < w; ++j) {
+                    uint64_t* row = a.row(first + j);
+                    for (size_t i = 0; i < j; ++i) {
+                        uint64_t f = row[pivots[firstPivot + i]];
+                        if (f != 0) {
+                            axpy(field, row, a.row(first + i), f, from, to);
+                        }
+                    }
+                    scale(field, row, inverses[j], from, to);
+                }
+            });
+
+            // Остальные строки: C += F * T
+            size_t below = rows - cur;
+            if (below > 0) {
+                factors.assign(below * w, 0);
+                for (size_t i = 0; i < below; ++i) {
+                    const uint64_t* row = a.row(cur + i);
+                    for (size_t j = 0; j < w; ++j) {
+                        factors[i * w + j] = row[pivots[firstPivot + j]];
+                    }
+                }
+                multiplyAddParallel(field, plan, {factors.data(), w}, a.sub(first, c1),
+                                    a.sub(cur, c1), below, w, cols - c1);
+            }
+        }
+
+        // Множители больше не нужны: под ведущими элементами нули
+        for (size_t j = 0; j < w && !lu; ++j) {
+            size_t col = pivots[firstPivot + j];
+            for (size_t i = first + j + 1; i < rows; ++i) {
+                a.row(i)[col] = 0;
+            }
+        }
+    }
+
+    if (!backward || lu) {
+        return pivots;
+    }
+
+    // Обратный ход блоками ведущих строк от последнего к первому
+    for (size_t end = pivots.size(); end > 0;) {
+        size_t begin = end > kPanelWidth ? end - kPanelWidth : 0;
+        size_t w = end - begin;
+        size_t c0 = pivots[begin];
+
+        // Внутри блока: множители не меняются до своего шага, поэтому
+        // собираются заранее, а столбцы обрабатываются независимо
+        factors.assign(w * w, 0);
+        for (size_t i = 0; i < w; ++i) {
+            for (size_t j = i + 1; j < w; ++j) {
+                factors[i * w + j] = field.neg(a.row(begin + i)[pivots[begin + j]]);
+            }
+        }
+        forRanges(plan, c0, cols, kColumnGrain, w * w, [&](size_t from, size_t to) {
+            for (size_t j = w; j-- > 0;) {
+                const uint64_t* src = a.row(begin + j);
+                size_t start = std::max(from, pivots[begin + j]);
+                for (size_t i = 0; i < j; ++i) {
+                    uint64_t f = factors[i * w + j];
+                    if (f != 0 && start < to) {
+                        axpy(field, a.row(begin + i), src, f, start, to);
+                    }
+                }
+            }
+        });
+
+        // Строки выше блока: C += F * T (ведущие столбцы обнуляются сами)
+        if (begin > 0) {
+            factors.assign(begin * w, 0);
+            for (size_t i = 0; i < begin; ++i) {
+                const uint64_t* row = a.row(i);
+                for (size_t j = 0; j < w; ++j) {
+                    factors[i * w + j] = field.neg(row[pivots[begin + j]]);
+                }
+            }
+            multiplyAddParallel(field, plan, {factors.data(), w}, a.sub(begin, c0),
+                                a.sub(0, c0), begin, w, cols - c0);
+        }
+        end = begin;
+    }
+
+    return pivots;
+}
+
+} // namespace detail
+} // namespace matrix_gf2
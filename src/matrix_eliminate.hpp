@@ -0,0 +1,61 @@
+#ifndef MATRIX_GF2_SRC_MATRIX_ELIMINATE_HPP
+#define MATRIX_GF2_SRC_MATRIX_ELIMINATE_HPP
+
+#include "matrix_multiply.hpp"
+#include <functional>
+#include <vector>
+
+namespace matrix_gf2 {
+namespace detail {
+
+// Минимум строк на задачу при делении строк между потоками
+constexpr size_t kRowGrain = 32;
+
+// Вызов fn(from, to) для поддиапазонов [first, last), параллельно в пуле плана,
+// если работа (число индексов x work) достаточно велика; каждая задача
+// обрабатывает не меньше grain индексов
+void forRanges(const MultiplyPlan& plan, size_t first, size_t last, size_t grain,
+               size_t work, const std::function<void(size_t, size_t)>& fn);
+
+// row[j] += f * src[j], from <= j < to (упакованные значения)
+inline void axpy(const Field& field, uint64_t* row, const uint64_t* src, uint64_t f,
+                 size_t from, size_t to) {
+    for (size_t j = from; j < to; ++j) {
+        row[j] = field.add(row[j], field.mul(f, src[j]));
+    }
+}
+
+/**
+ * @brief Данные для LU-разложения, собираемые при исключении
+ */
+struct EliminationFactors {
+    std::vector<size_t> rowOrder;       // Итоговая строка i - исходная строка rowOrder[i]
+    std::vector<uint64_t> pivotValues;  // Ведущие элементы до нормировки строк
+};
+
+/**
+ * @brief Блочное исключение Гаусса над упакованными значениями (на месте)
+ *
+ * Результат совпадает с поэлементным Matrix::gaussElimination: ведущий
+ * элемент - первая ненулевая строка, ведущие строки нормируются. Столбцы
+ * обрабатываются панелями: в панели исключение идёт по столбцам, а
+ * множители сохраняются на месте обнуляемых элементов; затем остаток
+ * строк справа от панели обновляется одним умножением C += F * T
+ * (multiplyAddParallel). Обратный ход (backward) так же обрабатывает
+ * ведущие строки блоками от последнего к первому.
+ *
+ * Если задан lu, множители f (строка += f * ведущая строка) остаются
+ * на месте обнуляемых элементов, а перестановка строк и ведущие элементы
+ * записываются в lu; обратный ход при этом не выполняется.
+ *
+ * @param a Матрица rows x cols (строки переставляются физически)
+ * @return Ведущие столбцы (их число - ранг)
+ */
+std::vector<size_t> eliminateBlocked(const Field& field, const MultiplyPlan& plan, Block a,
+                                     size_t rows, size_t cols, bool backward,
+                                     EliminationFactors* lu = nullptr);
+
+} // namespace detail
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_SRC_MATRIX_ELIMINATE_HPP
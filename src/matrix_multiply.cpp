@@ -0,0 +1,268 @@
+#include "matrix_multiply.hpp"
+#include "gemm_prime.hpp"
+#include "../include/matrix_gf2/thread_pool.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace matrix_gf2 {
+namespace detail {
+
+namespace {
+
+// Размеры плиток классического умножения (строки B и столбцы C)
+constexpr size_t kTileK = 64;
+constexpr size_t kTileN = 256;
+
+// Пороги Штрассена по умолчанию: для простых полей классическое ядро
+// с отложенным приведением выгоднее рекурсии вплоть до больших размеров
+constexpr size_t kStrassenThreshold = 128;
+constexpr size_t kStrassenThresholdDelayed = 512;
+
+// Параллельно умножаются произведения от m * k * n = 2^24 (256^3);
+// плитки C не меньше kParallelMinTile по каждому измерению, примерно
+// kParallelTasksPerThread плиток на поток для балансировки
+constexpr size_t kParallelMinWork = size_t(1) << 24;
+constexpr size_t kParallelMinTile = 128;
+constexpr size_t kParallelTasksPerThread = 4;
+
+// Временная матрица m x n
+struct Temp {
+    std::vector<uint64_t> storage;
+    Block block;
+
+    Temp(size_t m, size_t n) : storage(m * n), block{storage.data(), n} {}
+};
+
+// dest = x + y (m x n)
+void addBlocks(const Field& field, ConstBlock x, ConstBlock y, Block dest,
+               size_t m, size_t n) {
+    if (field.m() == 1) {
+        const uint64_t p = field.p();
+        for (size_t i = 0; i < m; ++i) {
+            const uint64_t* xr = x.row(i);
+            const uint64_t* yr = y.row(i);
+            uint64_t* dr = dest.row(i);
+            for (size_t j = 0; j < n; ++j) {
+                uint64_t s = xr[j] + yr[j];
+                dr[j] = (s >= p || s < xr[j]) ? s - p : s;
+            }
+        }
+        return;
+    }
+    for (size_t i = 0; i < m; ++i) {
+        const uint64_t* xr = x.row(i);
+        const uint64_t* yr = y.row(i);
+        uint64_t* dr = dest.row(i);
+        for (size_t j = 0; j < n; ++j) {
+            dr[j] = field.add(xr[j], yr[j]);
+        }
+    }
+}
+
+// dest = x - y (m x n)
+void subBlocks(const Field& field, ConstBlock x, ConstBlock y, Block dest,
+               size_t m, size_t n) {
+    if (field.m() == 1) {
+        const uint64_t p = field.p();
+        for (size_t i = 0; i < m; ++i) {
+            const uint64_t* xr = x.row(i);
+            const uint64_t* yr = y.row(i);
+            uint64_t* dr = dest.row(i);
+            for (size_t j = 0; j < n; ++j) {
+                dr[j] = xr[j] >= yr[j] ? xr[j] - yr[j] : xr[j] + (p - yr[j]);
+            }
+        }
+        return;
+    }
+    for (size_t i = 0; i < m; ++i) {
+        const uint64_t* xr = x.row(i);
+        const uint64_t* yr = y.row(i);
+        uint64_t* dr = dest.row(i);
+        for (size_t j = 0; j < n; ++j) {
+            dr[j] = field.sub(xr[j], yr[j]);
+        }
+    }
+}
+
+// C += A * B для блоков без пересечения
+void multiplyAddClassic(const Field& field, const MultiplyPlan& plan, ConstBlock a,
+                        ConstBlock b, Block c, size_t m, size_t k, size_t n) {
+    // Простые поля: упакованное умножение с отложенным приведением
+    if (plan.kernel == GemmKernel::DelayedDouble) {
+        gemmPrimeDouble(field, a, b, c, m, k, n);
+        return;
+    }
+    if (plan.kernel == GemmKernel::DelayedInteger) {
+        gemmPrime(field, a, b, c, m, k, n);
+        return;
+    }
+
+    for (size_t j0 = 0; j0 < n; j0 += kTileN) {
+        size_t j1 = std::min(n, j0 + kTileN);
+        for (size_t k0 = 0; k0 < k; k0 += kTileK) {
+            size_t k1 = std::min(k, k0 + kTileK);
+            for (size_t i = 0; i < m; ++i) {
+                const uint64_t* ar = a.row(i);
+                uint64_t* cr = c.row(i);
+                for (size_t t = k0; t < k1; ++t) {
+                    uint64_t x = ar[t];
+                    if (x == 0) {
+                        continue;
+                    }
+                    const uint64_t* br = b.row(t);
+                    for (size_t j = j0; j < j1; ++j) {
+                        cr[j] = field.add(cr[j], field.mul(x, br[j]));
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Вызов fn(i0, j0, rows, cols) для плиток C (m x n), параллельно в пуле плана;
+// малые произведения - одной плиткой в вызывающем потоке
+void forEachTile(const MultiplyPlan& plan, size_t m, size_t k, size_t n,
+                 const std::function<void(size_t, size_t, size_t, size_t)>& fn) {
+    if (m == 0 || n == 0) {
+        return;
+    }
+    if (m * k * n < kParallelMinWork) {
+        fn(0, 0, m, n);
+        return;
+    }
+    ThreadPool& pool = plan.pool ? *plan.pool : ThreadPool::global();
+    if (pool.size() == 1) {
+        fn(0, 0, m, n);
+        return;
+    }
+
+    // Сетка rowParts x colParts плиток: сначала делятся строки, затем столбцы
+    size_t target = pool.size() * kParallelTasksPerThread;
+    size_t rowParts = std::max<size_t>(1, std::min(target, m / kParallelMinTile));
+    size_t colParts = std::max<size_t>(1, std::min((target + rowParts - 1) / rowParts,
+                                                   n / kParallelMinTile));
+    size_t tileM = (m + rowParts - 1) / rowParts;
+    size_t tileN = (n + colParts - 1) / colParts;
+    rowParts = (m + tileM - 1) / tileM;
+    colParts = (n + tileN - 1) / tileN;
+
+    pool.parallelFor(rowParts * colParts, [&](size_t task) {
+        size_t i0 = task / colParts * tileM;
+        size_t j0 = task % colParts * tileN;
+        fn(i0, j0, std::min(tileM, m - i0), std::min(tileN, n - j0));
+    });
+}
+
+} // namespace
+
+MultiplyPlan planMultiply(const Field& field, const MultiplyOptions& options) {
+    MultiplyPlan plan{kStrassenThreshold, GemmKernel::Generic, options.pool};
+    if (options.floatingPoint && supportsDoubleKernel(field)) {
+        plan.kernel = GemmKernel::DelayedDouble;
+    } else if (supportsDelayedReduction(field)) {
+        plan.kernel = GemmKernel::DelayedInteger;
+    }
+    if (plan.kernel != GemmKernel::Generic) {
+        plan.strassenThreshold = kStrassenThresholdDelayed;
+    }
+    if (options.strassenThreshold) {
+        plan.strassenThreshold = *options.strassenThreshold;
+    }
+    return plan;
+}
+
+void multiplyClassic(const Field& field, const MultiplyPlan& plan, ConstBlock a,
+                     ConstBlock b, Block c, size_t m, size_t k, size_t n) {
+    for (size_t i = 0; i < m; ++i) {
+        std::fill(c.row(i), c.row(i) + n, uint64_t(0));
+    }
+    multiplyAddClassic(field, plan, a, b, c, m, k, n);
+}
+
+void multiplyStrassen(const Field& field, const MultiplyPlan& plan, ConstBlock a,
+                      ConstBlock b, Block c, size_t m, size_t k, size_t n) {
+    size_t threshold = plan.strassenThreshold;
+    if (threshold == 0 || m < threshold || k < threshold || n < threshold) {
+        multiplyClassic(field, plan, a, b, c, m, k, n);
+        return;
+    }
+
+    // Чётная часть делится на 2 x 2 блока; отщеплённые строка/столбцы
+    // досчитываются в конце
+    size_t m2 = m / 2, k2 = k / 2, n2 = n / 2;
+
+    ConstBlock a11 = a, a12 = a.sub(0, k2), a21 = a.sub(m2, 0), a22 = a.sub(m2, k2);
+    ConstBlock b11 = b, b12 = b.sub(0, n2), b21 = b.sub(k2, 0), b22 = b.sub(k2, n2);
+    Block c11 = c, c12 = c.sub(0, n2), c21 = c.sub(m2, 0), c22 = c.sub(m2, n2);
+
+    // Схема Винограда: 7 умножений и 15 сложений
+    Temp s(m2, k2), t(k2, n2), p(m2, n2);
+
+    // M1 = A11 B11 (в p), M2 = A12 B21 (в C11), C11 = M1 + M2
+    multiplyStrassen(field, plan, a11, b11, p.block, m2, k2, n2);          // M1
+    multiplyStrassen(field, plan, a12, b21, c11, m2, k2, n2);              // M2
+    addBlocks(field, p.block, c11, c11, m2, n2);                           // C11 = M1 + M2
+
+    // S3 = A11 - A21, T3 = B22 - B12, M7 = S3 T3
+    subBlocks(field, a11, a21, s.block, m2, k2);
+    subBlocks(field, b22, b12, t.block, k2, n2);
+    multiplyStrassen(field, plan, s.block, t.block, c21, m2, k2, n2);      // C21 = M7
+
+    // S1 = A21 + A22, T1 = B12 - B11, M5 = S1 T1
+    addBlocks(field, a21, a22, s.block, m2, k2);
+    subBlocks(field, b12, b11, t.block, k2, n2);
+    multiplyStrassen(field, plan, s.block, t.block, c22, m2, k2, n2);      // C22 = M5
+
+    // S2 = S1 - A11, T2 = B22 - T1, M6 = S2 T2
+    subBlocks(field, s.block, a11, s.block, m2, k2);
+    subBlocks(field, b22, t.block, t.block, k2, n2);
+    Temp q(m2, n2);
+    multiplyStrassen(field, plan, s.block, t.block, q.block, m2, k2, n2);  // M6
+
+    // U2 = M1 + M6 (в p), U3 = U2 + M7 (в C21), U4 = U2 + M5 (в C12)
+    addBlocks(field, p.block, q.block, p.block, m2, n2);
+    addBlocks(field, p.block, c21, c21, m2, n2);
+    addBlocks(field, p.block, c22, c12, m2, n2);
+
+    // C22 = U7 = U3 + M5
+    addBlocks(field, c21, c22, c22, m2, n2);
+
+    // S4 = A12 - S2, M3 = S4 B22, C12 = U5 = U4 + M3
+    subBlocks(field, a12, s.block, s.block, m2, k2);
+    multiplyStrassen(field, plan, s.block, b22, q.block, m2, k2, n2);
+    addBlocks(field, c12, q.block, c12, m2, n2);
+
+    // T4 = T2 - B21, M4 = A22 T4, C21 = U6 = U3 - M4
+    subBlocks(field, t.block, b21, t.block, k2, n2);
+    multiplyStrassen(field, plan, a22, t.block, q.block, m2, k2, n2);
+    subBlocks(field, c21, q.block, c21, m2, n2);
+
+    // Отщеплённые части: нечётный k, последний столбец и последняя строка C
+    if (k % 2 != 0) {
+        multiplyAddClassic(field, plan, a.sub(0, k - 1), b.sub(k - 1, 0), c, 2 * m2, 1, 2 * n2);
+    }
+    if (n % 2 != 0) {
+        multiplyClassic(field, plan, a, b.sub(0, n - 1), c.sub(0, n - 1), 2 * m2, k, 1);
+    }
+    if (m % 2 != 0) {
+        multiplyClassic(field, plan, a.sub(m - 1, 0), b, c.sub(m - 1, 0), 1, k, n);
+    }
+}
+
+void multiplyParallel(const Field& field, const MultiplyPlan& plan, ConstBlock a,
+                      ConstBlock b, Block c, size_t m, size_t k, size_t n) {
+    forEachTile(plan, m, k, n, [&](size_t i0, size_t j0, size_t rows, size_t cols) {
+        multiplyStrassen(field, plan, a.sub(i0, 0), b.sub(0, j0), c.sub(i0, j0), rows, k, cols);
+    });
+}
+
+void multiplyAddParallel(const Field& field, const MultiplyPlan& plan, ConstBlock a,
+                         ConstBlock b, Block c, size_t m, size_t k, size_t n) {
+    forEachTile(plan, m, k, n, [&](size_t i0, size_t j0, size_t rows, size_t cols) {
+        multiplyAddClassic(field, plan, a.sub(i0, 0), b.sub(0, j0), c.sub(i0, j0), rows, k, cols);
+    });
+}
+
+} // namespace detail
+} // namespace matrix_gf2
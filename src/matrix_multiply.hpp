@@ -0,0 +1,95 @@
+#ifndef MATRIX_GF2_SRC_MATRIX_MULTIPLY_HPP
+#define MATRIX_GF2_SRC_MATRIX_MULTIPLY_HPP
+
+#include "../include/matrix_gf2/field.hpp"
+#include "../include/matrix_gf2/matrix.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace matrix_gf2 {
+namespace detail {
+
+/**
+ * @brief Блок матрицы из упакованных значений поля (построчно, шаг stride)
+ */
+struct Block {
+    uint64_t* data;
+    size_t stride;
+
+    uint64_t* row(size_t i) const { return data + i * stride; }
+    Block sub(size_t i, size_t j) const { return {data + i * stride + j, stride}; }
+};
+
+struct ConstBlock {
+    const uint64_t* data;
+    size_t stride;
+
+    ConstBlock(const uint64_t* d, size_t s) : data(d), stride(s) {}
+    ConstBlock(const Block& b) : data(b.data), stride(b.stride) {}
+
+    const uint64_t* row(size_t i) const { return data + i * stride; }
+    ConstBlock sub(size_t i, size_t j) const { return {data + i * stride + j, stride}; }
+};
+
+/**
+ * @brief Ядро классического умножения
+ */
+enum class GemmKernel {
+    Generic,         // поэлементная арифметика поля
+    DelayedInteger,  // GF(p), p <= 2^32: 64-битные суммы (gemmPrime)
+    DelayedDouble    // GF(p), p < 2^26: double и FMA (gemmPrimeDouble)
+};
+
+/**
+ * @brief Выбранные для умножения алгоритмы
+ */
+struct MultiplyPlan {
+    size_t strassenThreshold;
+    GemmKernel kernel;
+    ThreadPool* pool;  // nullptr - ThreadPool::global()
+};
+
+/**
+ * @brief План умножения над полем с учётом параметров и процессора
+ */
+MultiplyPlan planMultiply(const Field& field, const MultiplyOptions& options);
+
+/**
+ * @brief C = A * B классическим алгоритмом с блокировкой по кэшу
+ *
+ * A имеет размер m x k, B - k x n, C - m x n; C не должна пересекаться
+ * с A и B.
+ */
+void multiplyClassic(const Field& field, const MultiplyPlan& plan, ConstBlock a,
+                     ConstBlock b, Block c, size_t m, size_t k, size_t n);
+
+/**
+ * @brief C = A * B алгоритмом Штрассена-Винограда
+ *
+ * Рекурсия продолжается, пока все размеры не меньше plan.strassenThreshold;
+ * нечётные строки и столбцы отщепляются и досчитываются классически. При
+ * нулевом пороге сразу используется multiplyClassic.
+ */
+void multiplyStrassen(const Field& field, const MultiplyPlan& plan, ConstBlock a,
+                      ConstBlock b, Block c, size_t m, size_t k, size_t n);
+
+/**
+ * @brief C = A * B с распределением плиток C по потокам пула
+ *
+ * Каждая плитка (полоса строк A на полосу столбцов B) считается
+ * multiplyStrassen в своём потоке; малые произведения выполняются
+ * в вызывающем потоке.
+ */
+void multiplyParallel(const Field& field, const MultiplyPlan& plan, ConstBlock a,
+                      ConstBlock b, Block c, size_t m, size_t k, size_t n);
+
+/**
+ * @brief C += A * B классическим умножением с распределением плиток C по потокам
+ */
+void multiplyAddParallel(const Field& field, const MultiplyPlan& plan, ConstBlock a,
+                         ConstBlock b, Block c, size_t m, size_t k, size_t n);
+
+} // namespace detail
+} // namespace matrix_gf2
+
+#endif // MATRIX_GF2_SRC_MATRIX_MULTIPLY_HPP
@@ -0,0 +1,378 @@
+#include "../include/matrix_gf2/pluq.hpp"
+#include "matrix_eliminate.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace matrix_gf2 {
+
+namespace {
+
+// Блок строк треугольных подстановок; остальные строки обновляются умножением
+constexpr size_t kSolveBlock = 64;
+
+// Нечётна ли перестановка (по длинам циклов)
+bool isOddPermutation(const std::vector<size_t>& perm) {
+    std::vector<bool> seen(perm.size(), false);
+    bool odd = false;
+    for (size_t i = 0; i < perm.size(); ++i) {
+        size_t length = 0;
+        for (size_t j = i; !seen[j]; j = perm[j]) {
+            seen[j] = true;
+            ++length;
+        }
+        if (length > 0 && length % 2 == 0) {
+            odd = !odd;
+        }
+    }
+    return odd;
+}
+
+} // namespace
+
+PLUQ::PLUQ(size_t rows, size_t cols, const Field& field)
+    : rows_(rows), cols_(cols), field_(&field) {}
+
+PLUQ PLUQ::factor(const Matrix& a, const EliminationOptions& options) {
+    const Field& field = a.field();
+    PLUQ result(a.rows(), a.cols(), field);
+    result.pool_ = options.pool;
+
+    result.lu_.resize(a.rows() * a.cols());
+    for (size_t i = 0; i < a.rows(); ++i) {
+        const GFElement* src = a.rowData(i);
+        for (size_t j = 0; j < a.cols(); ++j) {
+            result.lu_[i * a.cols() + j] = src[j].raw();
+        }
+    }
+
+    MultiplyOptions multiplyOptions;
+    multiplyOptions.pool = options.pool;
+    detail::EliminationFactors factors;
+    result.pivots_ = detail::eliminateBlocked(
+        field, detail::planMultiply(field, multiplyOptions), {result.lu_.data(), a.cols()},
+        a.rows(), a.cols(), false, &factors);
+    result.rowPerm_ = std::move(factors.rowOrder);
+    result.pivotValues_ = std::move(factors.pivotValues);
+
+    // Исключение хранит множители f (строка += f * ведущая строка), L = -f
+    size_t r = result.pivots_.size();
+    for (size_t i = 1; i < a.rows(); ++i) {
+        uint64_t* row = result.lu_.data() + i * a.cols();
+        for (size_t j = 0; j < std::min(i, r); ++j) {
+            row[result.pivots_[j]] = field.neg(row[result.pivots_[j]]);
+        }
+    }
+
+    // Сначала ведущие столбцы, затем свободные
+    result.colPerm_ = result.pivots_;
+    std::vector<bool> isPivot(a.cols(), false);
+    for (size_t col : result.pivots_) {
+        isPivot[col] = true;
+    }
+    for (size_t j = 0; j < a.cols(); ++j) {
+        if (!isPivot[j]) {
+            result.colPerm_.push_back(j);
+        }
+    }
+    return result;
+}
+
+Matrix PLUQ::P() const {
+    Matrix result(rows_, rows_, *field_);
+    for (size_t i = 0; i < rows_; ++i) {
+        result.rowData(rowPerm_[i])[i] = GFElement(*field_, 1);
+    }
+    return result;
+}
+
+Matrix PLUQ::L() const {
+    size_t r = rank();
+    Matrix result(rows_, r, *field_);
+    for (size_t i = 0; i < rows_; ++i) {
+        const uint64_t* row = lu_.data() + i * cols_;
+        GFElement* dest = result.rowData(i);
+        for (size_t j = 0; j < std::min(i, r); ++j) {
+            dest[j] = GFElement::fromRaw(*field_, row[pivots_[j]]);
+        }
+        if (i < r) {
+            dest[i] = GFElement::fromRaw(*field_, pivotValues_[i]);
+        }
+    }
+    return result;
+}
+
+Matrix PLUQ::U() const {
+    Matrix result(rank(), cols_, *field_);
+    for (size_t i = 0; i < rank(); ++i) {
+        const uint64_t* row = lu_.data() + i * cols_;
+        GFElement* dest = result.rowData(i);
+        for (size_t j = 0; j < cols_; ++j) {
+            if (colPerm_[j] >= pivots_[i]) {
+                dest[j] = GFElement::fromRaw(*field_, row[colPerm_[j]]);
+            }
+        }
+    }
+    return result;
+}
+
+Matrix PLUQ::Q() const {
+    Matrix result(cols_, cols_, *field_);
+    for (size_t j = 0; j < cols_; ++j) {
+        result.rowData(j)[colPerm_[j]] = GFElement(*field_, 1);
+    }
+    return result;
+}
+
+std::vector<size_t> PLUQ::rowRankProfile() const {
+    // Строки A линейно независимы так же, как строки P * L (U - полного ранга
+    // по строкам), т.е. профиль - ведущие столбцы (P * L)^T
+    size_t r = rank();
+    std::vector<uint64_t> transposed(r * rows_, 0);
+    for (size_t i = 0; i < rows_; ++i) {
+        const uint64_t* row = lu_.data() + i * cols_;
+        for (size_t j = 0; j < std::min(i, r); ++j) {
+            transposed[j * rows_ + rowPerm_[i]] = row[pivots_[j]];
+        }
+        if (i < r) {
+            transposed[i * rows_ + rowPerm_[i]] = pivotValues_[i];
+        }
+    }
+    MultiplyOptions multiplyOptions;
+    multiplyOptions.pool = pool_;
+    return detail::eliminateBlocked(*field_, detail::planMultiply(*field_, multiplyOptions),
+                                    {transposed.data(), rows_}, r, rows_, false);
+}
+
+bool PLUQ::solvePacked(const std::vector<uint64_t>& b, size_t k, std::vector<uint64_t>& x,
+                       std::vector<size_t>* inconsistent) const {
+    const Field& field = *field_;
+    MultiplyOptions multiplyOptions;
+    multiplyOptions.pool = pool_;
+    const detail::MultiplyPlan plan = detail::planMultiply(field, multiplyOptions);
+    size_t r = rank();
+
+    // P * L * y = b: строки b в порядке разложения
+    std::vector<uint64_t> y(rows_ * k);
+    for (size_t i = 0; i < rows_; ++i) {
+        std::copy(b.begin() + rowPerm_[i] * k, b.begin() + (rowPerm_[i] + 1) * k,
+                  y.begin() + i * k);
+    }
+
+    // Прямая подстановка блоками: внутри блока - по строкам, остальные
+    // строки обновляются умножением y[i1..] -= L[i1.., i0..i1) * y[i0..i1)
+    std::vector<uint64_t> panel;
+    for (size_t i0 = 0; i0 < r; i0 += kSolveBlock) {
+        size_t i1 = std::min(r, i0 + kSolveBlock);
+        size_t w = i1 - i0;
+        for (size_t i = i0; i < i1; ++i) {
+            const uint64_t* row = lu_.data() + i * cols_;
+            uint64_t* yi = y.data() + i * k;
+            for (size_t j = i0; j < i; ++j) {
+                uint64_t l = row[pivots_[j]];
+                if (l != 0) {
+                    detail::axpy(field, yi, y.data() + j * k, field.neg(l), 0, k);
+                }
+            }
+            uint64_t inv = field.inv(pivotValues_[i]);
+            for (size_t t = 0; t < k; ++t) {
+                yi[t] = field.mul(yi[t], inv);
+            }
+        }
+
+        size_t below = rows_ - i1;
+        if (below > 0) {
+            panel.resize(below * w);
+            for (size_t i = 0; i < below; ++i) {
+                const uint64_t* row = lu_.data() + (i1 + i) * cols_;
+                for (size_t j = 0; j < w; ++j) {
+                    panel[i * w + j] = field.neg(row[pivots_[i0 + j]]);
+                }
+            }
+            detail::multiplyAddParallel(field, plan, {panel.data(), w}, {y.data() + i0 * k, k},
+                                        {y.data() + i1 * k, k}, below, w, k);
+        }
+    }
+
+    // Ненулевой остаток в строках r.. - система несовместна
+    bool consistent = true;
+    for (size_t t = 0; t < k; ++t) {
+        for (size_t i = r; i < rows_; ++i) {
+            if (y[i * k + t] != 0) {
+                consistent = false;
+                if (inconsistent) {
+                    inconsistent->push_back(t);
+                }
+                break;
+            }
+        }
+    }
+    if (!consistent && !inconsistent) {
+        return false;
+    }
+
+    // Обратная подстановка U * z = y (единичная диагональ) блоками снизу вверх
+    for (size_t i1 = r; i1 > 0;) {
+        size_t i0 = i1 > kSolveBlock ? i1 - kSolveBlock : 0;
+        size_t w = i1 - i0;
+        for (size_t i = i1; i-- > i0;) {
+            const uint64_t* row = lu_.data() + i * cols_;
+            uint64_t* yi = y.data() + i * k;
+            for (size_t j = i + 1; j < i1; ++j) {
+                uint64_t u = row[pivots_[j]];
+                if (u != 0) {
+                    detail::axpy(field, yi, y.data() + j * k, field.neg(u), 0, k);
+                }
+            }
+        }
+
+        if (i0 > 0) {
+            panel.resize(i0 * w);
+            for (size_t i = 0; i < i0; ++i) {
+                const uint64_t* row = lu_.data() + i * cols_;
+                for (size_t j = 0; j < w; ++j) {
+                    panel[i * w + j] = field.neg(row[pivots_[i0 + j]]);
+                }
+            }
+            detail::multiplyAddParallel(field, plan, {panel.data(), w}, {y.data() + i0 * k, k},
+                                        {y.data(), k}, i0, w, k);
+        }
+        i1 = i0;
+    }
+
+    // Свободные переменные равны нулю; столбцы несовместных систем - нули
+    x.assign(cols_ * k, 0);
+    for (size_t i = 0; i < r; ++i) {
+        std::copy(y.begin() + i * k, y.begin() + (i + 1) * k, x.begin() + pivots_[i] * k);
+    }
+    if (inconsistent) {
+        for (size_t t : *inconsistent) {
+            for (size_t i = 0; i < cols_; ++i) {
+                x[i * k + t] = 0;
+            }
+        }
+    }
+    return consistent;
+}
+
+std::optional<std::vector<GFElement>> PLUQ::solve(const std::vector<GFElement>& b) const {
+    if (b.size() != rows_) {
+        throw std::invalid_argument("Размер правой части не совпадает с числом строк");
+    }
+    std::vector<uint64_t> packed(rows_);
+    for (size_t i = 0; i < rows_; ++i) {
+        if (&b[i].field() != field_) {
+            throw std::invalid_argument("Правая часть задана над другим полем");
+        }
+        packed[i] = b[i].raw();
+    }
+
+    std::vector<uint64_t> x;
+    if (!solvePacked(packed, 1, x)) {
+        return std::nullopt;
+    }
+    std::vector<GFElement> result;
+    result.reserve(cols_);
+    for (uint64_t value : x) {
+        result.push_back(GFElement::fromRaw(*field_, value));
+    }
+    return result;
+}
+
+std::optional<Matrix> PLUQ::solve(const Matrix& b) const {
+    std::vector<size_t> inconsistent;
+    Matrix x = solve(b, inconsistent);
+    if (!inconsistent.empty()) {
+        return std::nullopt;
+    }
+    return x;
+}
+
+Matrix PLUQ::solve(const Matrix& b, std::vector<size_t>& inconsistentColumns) const {
+    if (b.rows() != rows_) {
+        throw std::invalid_argument("Размер правой части не совпадает с числом строк");
+    }
+    if (&b.field() != field_) {
+        throw std::invalid_argument("Правая часть задана над другим полем");
+    }
+    size_t k = b.cols();
+    std::vector<uint64_t> packed(rows_ * k);
+    for (size_t i = 0; i < rows_; ++i) {
+        const GFElement* src = b.rowData(i);
+        for (size_t j = 0; j < k; ++j) {
+            packed[i * k + j] = src[j].raw();
+        }
+    }
+
+    std::vector<uint64_t> x;
+    inconsistentColumns.clear();
+    solvePacked(packed, k, x, &inconsistentColumns);
+    Matrix result(cols_, k, *field_);
+    for (size_t i = 0; i < cols_; ++i) {
+        GFElement* dest = result.rowData(i);
+        for (size_t j = 0; j < k; ++j) {
+            dest[j] = GFElement::fromRaw(*field_, x[i * k + j]);
+        }
+    }
+    return result;
+}
+
+GFElement PLUQ::determinant() const {
+    if (rows_ != cols_) {
+        throw std::invalid_argument("Определитель определён только для квадратных матриц");
+    }
+    if (rank() < rows_) {
+        return GFElement(*field_);
+    }
+    // Q - тождественная перестановка; det U = 1
+    uint64_t det = 1;
+    for (uint64_t value : pivotValues_) {
+        det = field_->mul(det, value);
+    }
+    if (isOddPermutation(rowPerm_)) {
+        det = field_->neg(det);
+    }
+    return GFElement::fromRaw(*field_, det);
+}
+
+Matrix PLUQ::nullspace() const {
+    const Field& field = *field_;
+    size_t r = rank();
+    Matrix result(cols_, cols_ - r, *field_);
+
+    // Для свободного столбца f: x_f = 1, ведущие переменные - из U * x = 0
+    std::vector<uint64_t> x(cols_);
+    for (size_t t = 0; t < cols_ - r; ++t) {
+        size_t free = colPerm_[r + t];
+        std::fill(x.begin(), x.end(), uint64_t(0));
+        x[free] = 1;
+        for (size_t i = r; i-- > 0;) {
+            const uint64_t* row = lu_.data() + i * cols_;
+            uint64_t sum = free > pivots_[i] ? row[free] : 0;
+            for (size_t j = i + 1; j < r; ++j) {
+                sum = field.add(sum, field.mul(row[pivots_[j]], x[pivots_[j]]));
+            }
+            x[pivots_[i]] = field.neg(sum);
+        }
+        for (size_t i = 0; i < cols_; ++i) {
+            result.rowData(i)[t] = GFElement::fromRaw(field, x[i]);
+        }
+    }
+    return result;
+}
+
+std::optional<Matrix> PLUQ::inverse() const {
+    if (rows_ != cols_ || rank() < rows_) {
+        return std::nullopt;
+    }
+    Matrix identity(rows_, rows_, *field_);
+    for (size_t i = 0; i < rows_; ++i) {
+        identity.rowData(i)[i] = GFElement(*field_, 1);
+    }
+    return solve(identity);
+}
+
+PLUQ Matrix::pluq(const EliminationOptions& options) const {
+    return PLUQ::factor(*this, options);
+}
+
+} // namespace matrix_gf2
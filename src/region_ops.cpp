@@ -0,0 +1,405 @@
+#include "../include/matrix_gf2/region_ops.hpp"
+#include <cstring>
+#include <stdexcept>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define MATRIX_GF2_SIMD_DISPATCH 1
+#endif
+
+namespace matrix_gf2 {
+
+namespace {
+
+// Таблицы для GF(2^8): c * x = lo[x & 15] ^ hi[x >> 4]
+struct SplitTables8 {
+    alignas(16) uint8_t lo[16];
+    alignas(16) uint8_t hi[16];
+};
+
+// Таблицы для GF(2^16): t[k][b][i] - байт b произведения c * (i << 4k)
+struct SplitTables16 {
+    alignas(16) uint8_t t[4][2][16];
+};
+
+// Уровень набора инструкций
+enum class SimdLevel { Scalar, Ssse3, Avx2, Avx512 };
+
+SimdLevel detectSimdLevel() {
+#if defined(MATRIX_GF2_SIMD_DISPATCH)
+    if (__builtin_cpu_supports("avx512bw")) return SimdLevel::Avx512;
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+    if (__builtin_cpu_supports("ssse3")) return SimdLevel::Ssse3;
+#endif
+    return SimdLevel::Scalar;
+}
+
+SimdLevel simdLevel() {
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+void checkField(const Field& field, uint32_t m) {
+    if (field.p() != 2 || field.m() != m) {
+        throw std::invalid_argument(m == 8 ? "Поле должно быть GF(2^8)"
+                                           : "Поле должно быть GF(2^16)");
+    }
+}
+
+SplitTables8 makeTables8(const Field& field, uint8_t c) {
+    SplitTables8 t;
+    for (uint64_t i = 0; i < 16; ++i) {
+        t.lo[i] = static_cast<uint8_t>(field.mul(c, i));
+        t.hi[i] = static_cast<uint8_t>(field.mul(c, i << 4));
+    }
+    return t;
+}
+
+SplitTables16 makeTables16(const Field& field, uint16_t c) {
+    SplitTables16 t;
+    for (unsigned k = 0; k < 4; ++k) {
+        for (uint64_t i = 0; i < 16; ++i) {
+            uint64_t v = field.mul(c, i << (4 * k));
+            t.t[k][0][i] = static_cast<uint8_t>(v & 0xFF);
+            t.t[k][1][i] = static_cast<uint8_t>(v >> 8);
+        }
+    }
+    return t;
+}
+
+// ---------------------------------------------------------------------------
+// Скалярные ядра (также обрабатывают хвосты векторных)
+
+void mulRegion8Scalar(const SplitTables8& t, uint8_t* dest, const uint8_t* src,
+                      size_t n, bool accumulate) {
+    for (size_t i = 0; i < n; ++i) {
+        uint8_t x = src[i];
+        uint8_t r = static_cast<uint8_t>(t.lo[x & 15] ^ t.hi[x >> 4]);
+        dest[i] = accumulate ? static_cast<uint8_t>(dest[i] ^ r) : r;
+    }
+}
+
+void mulRegion16Scalar(const SplitTables16& t, uint16_t* dest, const uint16_t* src,
+                       size_t n, bool accumulate) {
+    uint16_t table[4][16];
+    for (unsigned k = 0; k < 4; ++k) {
+        for (unsigned i = 0; i < 16; ++i) {
+            table[k][i] = static_cast<uint16_t>(t.t[k][0][i] | (t.t[k][1][i] << 8));
+        }
+    }
+    for (size_t i = 0; i < n; ++i) {
+        uint16_t x = src[i];
+        uint16_t r = static_cast<uint16_t>(table[0][x & 15] ^ table[1][(x >> 4) & 15] ^
+                                           table[2][(x >> 8) & 15] ^ table[3][x >> 12]);
+        dest[i] = accumulate ? static_cast<uint16_t>(dest[i] ^ r) : r;
+    }
+}
+
+#if defined(MATRIX_GF2_SIMD_DISPATCH)
+
+// ---------------------------------------------------------------------------
+// SSSE3: 16 байт за итерацию
+
+__attribute__((target("ssse3")))
+void mulRegion8Ssse3(const SplitTables8& t, uint8_t* dest, const uint8_t* src,
+                     size_t n, bool accumulate) {
+    const __m128i lo = _mm_load_si128(reinterpret_cast<const __m128i*>(t.lo));
+    const __m128i hi = _mm_load_si128(reinterpret_cast<const __m128i*>(t.hi));
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i r = _mm_xor_si128(
+            _mm_shuffle_epi8(lo, _mm_and_si128(x, mask)),
+            _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi64(x, 4), mask)));
+        __m128i* out = reinterpret_cast<__m128i*>(dest + i);
+        if (accumulate) r = _mm_xor_si128(r, _mm_loadu_si128(out));
+        _mm_storeu_si128(out, r);
+    }
+    mulRegion8Scalar(t, dest + i, src + i, n - i, accumulate);
+}
+
+__attribute__((target("ssse3")))
+void mulRegion16Ssse3(const SplitTables16& t, uint16_t* dest, const uint16_t* src,
+                      size_t n, bool accumulate) {
+    __m128i table[4][2];
+    for (unsigned k = 0; k < 4; ++k) {
+        for (unsigned b = 0; b < 2; ++b) {
+            table[k][b] = _mm_load_si128(reinterpret_cast<const __m128i*>(t.t[k][b]));
+        }
+    }
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    // Младшие байты элементов - в нижнюю половину регистра, старшие - в верхнюю
+    const __m128i split = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14,
+                                        1, 3, 5, 7, 9, 11, 13, 15);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i* out0 = reinterpret_cast<__m128i*>(dest + i);
+        __m128i* out1 = reinterpret_cast<__m128i*>(dest + i + 8);
+        __m128i a = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), split);
+        __m128i b = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8)), split);
+        __m128i lo = _mm_unpacklo_epi64(a, b);
+        __m128i hi = _mm_unpackhi_epi64(a, b);
+        __m128i n0 = _mm_and_si128(lo, mask);
+        __m128i n1 = _mm_and_si128(_mm_srli_epi64(lo, 4), mask);
+        __m128i n2 = _mm_and_si128(hi, mask);
+        __m128i n3 = _mm_and_si128(_mm_srli_epi64(hi, 4), mask);
+        __m128i rl = _mm_xor_si128(
+            _mm_xor_si128(_mm_shuffle_epi8(table[0][0], n0), _mm_shuffle_epi8(table[1][0], n1)),
+            _mm_xor_si128(_mm_shuffle_epi8(table[2][0], n2), _mm_shuffle_epi8(table[3][0], n3)));
+        __m128i rh = _mm_xor_si128(
+            _mm_xor_si128(_mm_shuffle_epi8(table[0][1], n0), _mm_shuffle_epi8(table[1][1], n1)),
+            _mm_xor_si128(_mm_shuffle_epi8(table[2][1], n2), _mm_shuffle_epi8(table[3][1], n3)));
+        __m128i r0 = _mm_unpacklo_epi8(rl, rh);
+        __m128i r1 = _mm_unpackhi_epi8(rl, rh);
+        if (accumulate) {
+            r0 = _mm_xor_si128(r0, _mm_loadu_si128(out0));
+            r1 = _mm_xor_si128(r1, _mm_loadu_si128(out1));
+        }
+        _mm_storeu_si128(out0, r0);
+        _mm_storeu_si128(out1, r1);
+    }
+    mulRegion16Scalar(t, dest + i, src + i, n - i, accumulate);
+}
+
+// ---------------------------------------------------------------------------
+// AVX2: 32 байта за итерацию. PSHUFB и распаковка работают внутри 128-битных
+// половин, поэтому схема разделения байтов та же, что и для SSSE3
+
+__attribute__((target("avx2")))
+void mulRegion8Avx2(const SplitTables8& t, uint8_t* dest, const uint8_t* src,
+                    size_t n, bool accumulate) {
+    const __m256i lo = _mm256_broadcastsi128_si256(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(t.lo)));
+    const __m256i hi = _mm256_broadcastsi128_si256(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(t.hi)));
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i r = _mm256_xor_si256(
+            _mm256_shuffle_epi8(lo, _mm256_and_si256(x, mask)),
+            _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi64(x, 4), mask)));
+        __m256i* out = reinterpret_cast<__m256i*>(dest + i);
+        if (accumulate) r = _mm256_xor_si256(r, _mm256_loadu_si256(out));
+        _mm256_storeu_si256(out, r);
+    }
+    mulRegion8Ssse3(t, dest + i, src + i, n - i, accumulate);
+}
+
+__attribute__((target("avx2")))
+void mulRegion16Avx2(const SplitTables16& t, uint16_t* dest, const uint16_t* src,
+                     size_t n, bool accumulate) {
+    __m256i table[4][2];
+    for (unsigned k = 0; k < 4; ++k) {
+        for (unsigned b = 0; b < 2; ++b) {
+            table[k][b] = _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i*>(t.t[k][b])));
+        }
+    }
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i split = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i* out0 = reinterpret_cast<__m256i*>(dest + i);
+        __m256i* out1 = reinterpret_cast<__m256i*>(dest + i + 16);
+        __m256i a = _mm256_shuffle_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), split);
+        __m256i b = _mm256_shuffle_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 16)), split);
+        __m256i lo = _mm256_unpacklo_epi64(a, b);
+        __m256i hi = _mm256_unpackhi_epi64(a, b);
+        __m256i n0 = _mm256_and_si256(lo, mask);
+        __m256i n1 = _mm256_and_si256(_mm256_srli_epi64(lo, 4), mask);
+        __m256i n2 = _mm256_and_si256(hi, mask);
+        __m256i n3 = _mm256_and_si256(_mm256_srli_epi64(hi, 4), mask);
+        __m256i rl = _mm256_xor_si256(
+            _mm256_xor_si256(_mm256_shuffle_epi8(table[0][0], n0), _mm256_shuffle_epi8(table[1][0], n1)),
+            _mm256_xor_si256(_mm256_shuffle_epi8(table[2][0], n2), _mm256_shuffle_epi8(table[3][0], n3)));
+        __m256i rh = _mm256_xor_si256(
+            _mm256_xor_si256(_mm256_shuffle_epi8(table[0][1], n0), _mm256_shuffle_epi8(table[1][1], n1)),
+            _mm256_xor_si256(_mm256_shuffle_epi8(table[2][1], n2), _mm256_shuffle_epi8(table[3][1], n3)));
+        __m256i r0 = _mm256_unpacklo_epi8(rl, rh);
+        __m256i r1 = _mm256_unpackhi_epi8(rl, rh);
+        if (accumulate) {
+            r0 = _mm256_xor_si256(r0, _mm256_loadu_si256(out0));
+            r1 = _mm256_xor_si256(r1, _mm256_loadu_si256(out1));
+        }
+        _mm256_storeu_si256(out0, r0);
+        _mm256_storeu_si256(out1, r1);
+    }
+    mulRegion16Ssse3(t, dest + i, src + i, n - i, accumulate);
+}
+
+// ---------------------------------------------------------------------------
+// AVX-512BW: 64 байта за итерацию
+
+// Заголовки GCC 12 подставляют _mm512_undefined_* в неиспользуемый
+// источник маскированных встроенных функций, и после встраивания это даёт
+// ложные предупреждения о неинициализированном '__Y' (GCC bug 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f,avx512bw")))
+void mulRegion8Avx512(const SplitTables8& t, uint8_t* dest, const uint8_t* src,
+                      size_t n, bool accumulate) {
+    const __m512i lo = _mm512_broadcast_i32x4(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(t.lo)));
+    const __m512i hi = _mm512_broadcast_i32x4(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(t.hi)));
+    const __m512i mask = _mm512_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m512i x = _mm512_loadu_si512(src + i);
+        __m512i r = _mm512_xor_si512(
+            _mm512_shuffle_epi8(lo, _mm512_and_si512(x, mask)),
+            _mm512_shuffle_epi8(hi, _mm512_and_si512(_mm512_srli_epi64(x, 4), mask)));
+        if (accumulate) r = _mm512_xor_si512(r, _mm512_loadu_si512(dest + i));
+        _mm512_storeu_si512(dest + i, r);
+    }
+    mulRegion8Avx2(t, dest + i, src + i, n - i, accumulate);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void mulRegion16Avx512(const SplitTables16& t, uint16_t* dest, const uint16_t* src,
+                       size_t n, bool accumulate) {
+    __m512i table[4][2];
+    for (unsigned k = 0; k < 4; ++k) {
+        for (unsigned b = 0; b < 2; ++b) {
+            table[k][b] = _mm512_broadcast_i32x4(
+                _mm_load_si128(reinterpret_cast<const __m128i*>(t.t[k][b])));
+        }
+    }
+    const __m512i mask = _mm512_set1_epi8(0x0F);
+    const __m512i split = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m512i a = _mm512_shuffle_epi8(_mm512_loadu_si512(src + i), split);
+        __m512i b = _mm512_shuffle_epi8(_mm512_loadu_si512(src + i + 32), split);
+        __m512i lo = _mm512_unpacklo_epi64(a, b);
+        __m512i hi = _mm512_unpackhi_epi64(a, b);
+        __m512i n0 = _mm512_and_si512(lo, mask);
+        __m512i n1 = _mm512_and_si512(_mm512_srli_epi64(lo, 4), mask);
+        __m512i n2 = _mm512_and_si512(hi, mask);
+        __m512i n3 = _mm512_and_si512(_mm512_srli_epi64(hi, 4), mask);
+        __m512i rl = _mm512_xor_si512(
+            _mm512_xor_si512(_mm512_shuffle_epi8(table[0][0], n0), _mm512_shuffle_epi8(table[1][0], n1)),
+            _mm512_xor_si512(_mm512_shuffle_epi8(table[2][0], n2), _mm512_shuffle_epi8(table[3][0], n3)));
+        __m512i rh = _mm512_xor_si512(
+            _mm512_xor_si512(_mm512_shuffle_epi8(table[0][1], n0), _mm512_shuffle_epi8(table[1][1], n1)),
+            _mm512_xor_si512(_mm512_shuffle_epi8(table[2][1], n2), _mm512_shuffle_epi8(table[3][1], n3)));
+        __m512i r0 = _mm512_unpacklo_epi8(rl, rh);
+        __m512i r1 = _mm512_unpackhi_epi8(rl, rh);
+        if (accumulate) {
+            r0 = _mm512_xor_si512(r0, _mm512_loadu_si512(dest + i));
+            r1 = _mm512_xor_si512(r1, _mm512_loadu_si512(dest + i + 32));
+        }
+        _mm512_storeu_si512(dest + i, r0);
+        _mm512_storeu_si512(dest + i + 32, r1);
+    }
+    mulRegion16Avx2(t, dest + i, src + i, n - i, accumulate);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // MATRIX_GF2_SIMD_DISPATCH
+
+void mulRegion8(const SplitTables8& t, uint8_t* dest, const uint8_t* src,
+                size_t n, bool accumulate) {
+#if defined(MATRIX_GF2_SIMD_DISPATCH)
+    switch (simdLevel()) {
+        case SimdLevel::Avx512: return mulRegion8Avx512(t, dest, src, n, accumulate);
+        case SimdLevel::Avx2: return mulRegion8Avx2(t, dest, src, n, accumulate);
+        case SimdLevel::Ssse3: return mulRegion8Ssse3(t, dest, src, n, accumulate);
+        case SimdLevel::Scalar: break;
+    }
+#endif
+    mulRegion8Scalar(t, dest, src, n, accumulate);
+}
+
+void mulRegion16(const SplitTables16& t, uint16_t* dest, const uint16_t* src,
+                 size_t n, bool accumulate) {
+#if defined(MATRIX_GF2_SIMD_DISPATCH)
+    switch (simdLevel()) {
+        case SimdLevel::Avx512: return mulRegion16Avx512(t, dest, src, n, accumulate);
+        case SimdLevel::Avx2: return mulRegion16Avx2(t, dest, src, n, accumulate);
+        case SimdLevel::Ssse3: return mulRegion16Ssse3(t, dest, src, n, accumulate);
+        case SimdLevel::Scalar: break;
+    }
+#endif
+    mulRegion16Scalar(t, dest, src, n, accumulate);
+}
+
+template <typename T>
+void xorRegion(T* dest, const T* src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dest[i] ^= src[i];
+    }
+}
+
+} // namespace
+
+void regionMultiplyAdd(const Field& field, uint8_t* dest, const uint8_t* src,
+                       uint8_t c, size_t n) {
+    checkField(field, 8);
+    if (c == 0) return;
+    if (c == 1) return xorRegion(dest, src, n);
+    mulRegion8(makeTables8(field, c), dest, src, n, true);
+}
+
+void regionMultiply(const Field& field, uint8_t* dest, const uint8_t* src,
+                    uint8_t c, size_t n) {
+    checkField(field, 8);
+    if (c == 0) {
+        std::memset(dest, 0, n);
+        return;
+    }
+    if (c == 1) {
+        std::memmove(dest, src, n);
+        return;
+    }
+    mulRegion8(makeTables8(field, c), dest, src, n, false);
+}
+
+void regionMultiplyAdd(const Field& field, uint16_t* dest, const uint16_t* src,
+                       uint16_t c, size_t n) {
+    checkField(field, 16);
+    if (c == 0) return;
+    if (c == 1) return xorRegion(dest, src, n);
+    mulRegion16(makeTables16(field, c), dest, src, n, true);
+}
+
+void regionMultiply(const Field& field, uint16_t* dest, const uint16_t* src,
+                    uint16_t c, size_t n) {
+    checkField(field, 16);
+    if (c == 0) {
+        std::memset(dest, 0, n * sizeof(uint16_t));
+        return;
+    }
+    if (c == 1) {
+        std::memmove(dest, src, n * sizeof(uint16_t));
+        return;
+    }
+    mulRegion16(makeTables16(field, c), dest, src, n, false);
+}
+
+const char* regionKernelName() {
+    switch (simdLevel()) {
+        case SimdLevel::Avx512: return "avx512bw";
+        case SimdLevel::Avx2: return "avx2";
+        case SimdLevel::Ssse3: return "ssse3";
+        case SimdLevel::Scalar: break;
+    }
+    return "scalar";
+}
+
+} // namespace matrix_gf2
@@ -0,0 +1,16 @@
+#include "../include/matrix_gf2/solve.hpp"
+
+namespace matrix_gf2 {
+
+SolveResult solve(const Matrix& a, const Matrix& b, const EliminationOptions& options) {
+    PLUQ factors = PLUQ::factor(a, options);
+    std::vector<size_t> inconsistent;
+    Matrix x = factors.solve(b, inconsistent);
+
+    SolveResult result(x, factors.nullspace());
+    result.inconsistentColumns = std::move(inconsistent);
+    result.rank = factors.rank();
+    return result;
+}
+
+} // namespace matrix_gf2
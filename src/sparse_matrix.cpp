@@ -0,0 +1,554 @@
+#include "../include/matrix_gf2/sparse_matrix.hpp"
+#include "../include/matrix_gf2/bit_matrix.hpp"
+#include "bit_ops.hpp"
+#include "matrix_eliminate.hpp"
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+namespace matrix_gf2 {
+
+namespace {
+
+// Активная подматрица r x c переводится в плотный вид, когда число
+// ненулевых элементов достигает kDenseDensity * r * c - доли того плотного
+// блока r x c, который затем выделяется
+constexpr double kDenseDensity = 0.05;
+
+// Число самых коротких столбцов, просматриваемых при выборе ведущего элемента
+constexpr size_t kMarkowitzColumns = 4;
+
+struct Entry {
+    size_t col;
+    uint64_t value;
+};
+
+using SparseRow = std::vector<Entry>;
+
+// Ведущие строки в порядке исключения: строка t нормирована (единица в
+// pivotCols[t]) и не содержит ведущих столбцов предыдущих строк
+struct Echelon {
+    std::vector<size_t> pivotCols;
+    std::vector<SparseRow> pivotRows;
+    std::vector<uint64_t> rhs;
+    bool consistent = true;
+};
+
+const Entry* findEntry(const SparseRow& row, size_t col) {
+    auto it = std::lower_bound(row.begin(), row.end(), col,
+                               [](const Entry& e, size_t c) { return e.col < c; });
+    return it != row.end() && it->col == col ? &*it : nullptr;
+}
+
+// Активная часть исключения: строки, счётчики столбцов и списки строк
+// столбцов (в списках могут оставаться устаревшие строки - они проверяются
+// при использовании)
+class StructuredElimination {
+public:
+    StructuredElimination(const Field& field, size_t rows, size_t cols)
+        : field_(field), rows_(rows), rhs_(rows, 0), active_(rows, false),
+          colCount_(cols, 0), colRows_(cols) {}
+
+    void setRow(size_t i, SparseRow row, uint64_t rhs) {
+        rhs_[i] = rhs;
+        if (row.empty()) {
+            if (rhs != 0) {
+                result_.consistent = false;
+            }
+            return;
+        }
+        for (const Entry& e : row) {
+            colRows_[e.col].push_back(i);
+            adjustCount(e.col, true);
+        }
+        activeNnz_ += row.size();
+        rows_[i] = std::move(row);
+        active_[i] = true;
+        ++activeRows_;
+    }
+
+    // Исключение по Марковицу, пока активная подматрица достаточно разрежена
+    void eliminateSparse() {
+        while (activeRows_ > 0 &&
+               double(activeNnz_) < kDenseDensity * double(activeRows_) * double(activeCols_)) {
+            size_t pivotRow = 0;
+            size_t pivotCol = 0;
+            choosePivot(pivotRow, pivotCol);
+            eliminate(pivotRow, pivotCol);
+        }
+    }
+
+    // Плотное исключение оставшейся активной подматрицы; столбец правой
+    // части (если есть) добавляется последним: ведущий элемент в нём
+    // означает несовместность
+    void eliminateDense(const EliminationOptions& options, bool withRhs) {
+        if (activeRows_ == 0) {
+            return;
+        }
+        std::vector<size_t> rowList;
+        for (size_t i = 0; i < rows_.size(); ++i) {
+            if (active_[i]) {
+                rowList.push_back(i);
+            }
+        }
+        std::vector<size_t> colList;
+        std::vector<size_t> local(colCount_.size(), 0);
+        for (size_t c = 0; c < colCount_.size(); ++c) {
+            if (colCount_[c] > 0) {
+                local[c] = colList.size();
+                colList.push_back(c);
+            }
+        }
+
+        if (field_.p() == 2 && field_.m() == 1) {
+            eliminateBits(rowList, colList, local, withRhs);
+        } else {
+            eliminatePacked(rowList, colList, local, withRhs, options);
+        }
+    }
+
+    Echelon& result() { return result_; }
+
+private:
+    // Плотная часть над GF(2): упакованная битовая матрица (M4RI)
+    void eliminateBits(const std::vector<size_t>& rowList, const std::vector<size_t>& colList,
+                       const std::vector<size_t>& local, bool withRhs) {
+        size_t width = colList.size() + (withRhs ? 1 : 0);
+        BitMatrix dense(rowList.size(), width);
+        for (size_t t = 0; t < rowList.size(); ++t) {
+            uint64_t* row = dense.row(t);
+            for (const Entry& e : rows_[rowList[t]]) {
+                row[local[e.col] / 64] |= uint64_t(1) << (local[e.col] % 64);
+            }
+            if (withRhs && rhs_[rowList[t]] != 0) {
+                row[colList.size() / 64] |= uint64_t(1) << (colList.size() % 64);
+            }
+        }
+
+        BitGaussResult echelon = dense.forwardGauss();
+        for (size_t t = 0; t < echelon.rank; ++t) {
+            size_t pivot = echelon.pivotCols[t];
+            if (pivot == colList.size()) {
+                result_.consistent = false;
+                break;
+            }
+            const uint64_t* row = echelon.matrix.row(t);
+            SparseRow sparse;
+            for (size_t w = pivot / 64; w < echelon.matrix.words(); ++w) {
+                for (uint64_t bits = row[w]; bits != 0; bits &= bits - 1) {
+                    size_t l = w * 64 + detail::countTrailingZeros(bits);
+                    if (l < colList.size()) {
+                        sparse.push_back({colList[l], 1});
+                    }
+                }
+            }
+            bool rhs = withRhs && (row[colList.size() / 64] >> (colList.size() % 64) & 1);
+            result_.pivotCols.push_back(colList[pivot]);
+            result_.pivotRows.push_back(std::move(sparse));
+            result_.rhs.push_back(rhs ? 1 : 0);
+        }
+    }
+
+    // Плотная часть над остальными полями: блочное исключение
+    void eliminatePacked(const std::vector<size_t>& rowList, const std::vector<size_t>& colList,
+                         const std::vector<size_t>& local, bool withRhs,
+                         const EliminationOptions& options) {
+        size_t width = colList.size() + (withRhs ? 1 : 0);
+        std::vector<uint64_t> dense(rowList.size() * width, 0);
+        for (size_t t = 0; t < rowList.size(); ++t) {
+            uint64_t* row = dense.data() + t * width;
+            for (const Entry& e : rows_[rowList[t]]) {
+                row[local[e.col]] = e.value;
+            }
+            if (withRhs) {
+                row[colList.size()] = rhs_[rowList[t]];
+            }
+        }
+
+        MultiplyOptions multiplyOptions;
+        multiplyOptions.pool = options.pool;
+        std::vector<size_t> pivots = detail::eliminateBlocked(
+            field_, detail::planMultiply(field_, multiplyOptions), {dense.data(), width},
+            rowList.size(), width, false);
+
+        for (size_t t = 0; t < pivots.size(); ++t) {
+            if (pivots[t] == colList.size()) {
+                result_.consistent = false;
+                break;
+            }
+            const uint64_t* row = dense.data() + t * width;
+            SparseRow sparse;
+            for (size_t l = pivots[t]; l < colList.size(); ++l) {
+                if (row[l] != 0) {
+                    sparse.push_back({colList[l], row[l]});
+                }
+            }
+            result_.pivotCols.push_back(colList[pivots[t]]);
+            result_.pivotRows.push_back(std::move(sparse));
+            result_.rhs.push_back(withRhs ? row[colList.size()] : 0);
+        }
+    }
+
+    void adjustCount(size_t col, bool increment) {
+        size_t& count = colCount_[col];
+        if (count > 0) {
+            byCount_.erase({count, col});
+        }
+        count = increment ? count + 1 : count - 1;
+        if (count > 0) {
+            byCount_.insert({count, col});
+        }
+        if (increment && count == 1) {
+            ++activeCols_;
+        } else if (!increment && count == 0) {
+            --activeCols_;
+        }
+    }
+
+    void choosePivot(size_t& pivotRow, size_t& pivotCol) {
+        size_t bestCost = std::numeric_limits<size_t>::max();
+        size_t examined = 0;
+        for (auto it = byCount_.begin(); it != byCount_.end() && examined < kMarkowitzColumns;
+             ++it, ++examined) {
+            size_t col = it->second;
+            std::vector<size_t>& list = colRows_[col];
+            size_t kept = 0;
+            for (size_t i : list) {
+                if (active_[i] && findEntry(rows_[i], col)) {
+                    list[kept++] = i;
+                }
+            }
+            list.resize(kept);
+
+            for (size_t i : list) {
+                size_t cost = (rows_[i].size() - 1) * (it->first - 1);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    pivotRow = i;
+                    pivotCol = col;
+                }
+            }
+            if (bestCost == 0) {
+                return;
+            }
+        }
+    }
+
+    void eliminate(size_t p, size_t col) {
+        SparseRow pivot = std::move(rows_[p]);
+        active_[p] = false;
+        --activeRows_;
+        activeNnz_ -= pivot.size();
+        for (const Entry& e : pivot) {
+            adjustCount(e.col, false);
+        }
+
+        uint64_t inv = field_.inv(findEntry(pivot, col)->value);
+        for (Entry& e : pivot) {
+            e.value = field_.mul(e.value, inv);
+        }
+        uint64_t pivotRhs = field_.mul(rhs_[p], inv);
+
+        // row_i += f * pivot, столбец col обнуляется
+        SparseRow merged;
+        std::vector<size_t> list = std::move(colRows_[col]);
+        colRows_[col].clear();
+        for (size_t i : list) {
+            if (!active_[i]) {
+                continue;
+            }
+            SparseRow& row = rows_[i];
+            const Entry* target = findEntry(row, col);
+            if (!target) {
+                continue;
+            }
+            uint64_t f = field_.neg(target->value);
+
+            merged.clear();
+            size_t a = 0;
+            size_t b = 0;
+            while (a < row.size() || b < pivot.size()) {
+                if (b == pivot.size() || (a < row.size() && row[a].col < pivot[b].col)) {
+                    merged.push_back(row[a++]);
+                } else if (a == row.size() || pivot[b].col < row[a].col) {
+                    // Заполнение
+                    merged.push_back({pivot[b].col, field_.mul(f, pivot[b].value)});
+                    colRows_[pivot[b].col].push_back(i);
+                    adjustCount(pivot[b].col, true);
+                    ++b;
+                } else {
+                    size_t c = row[a].col;
+                    uint64_t value = c == col ? 0 : field_.add(row[a].value,
+                                                               field_.mul(f, pivot[b].value));
+                    if (value != 0) {
+                        merged.push_back({c, value});
+                    } else {
+                        adjustCount(c, false);
+                    }
+                    ++a;
+                    ++b;
+                }
+            }
+            activeNnz_ = activeNnz_ + merged.size() - row.size();
+            row.swap(merged);
+            rhs_[i] = field_.add(rhs_[i], field_.mul(f, pivotRhs));
+
+            if (row.empty()) {
+                active_[i] = false;
+                --activeRows_;
+                if (rhs_[i] != 0) {
+                    result_.consistent = false;
+                }
+            }
+        }
+
+        result_.pivotCols.push_back(col);
+        result_.pivotRows.push_back(std::move(pivot));
+        result_.rhs.push_back(pivotRhs);
+    }
+
+    const Field& field_;
+    std::vector<SparseRow> rows_;
+    std::vector<uint64_t> rhs_;
+    std::vector<bool> active_;
+    std::vector<size_t> colCount_;
+    std::vector<std::vector<size_t>> colRows_;
+    std::set<std::pair<size_t, size_t>> byCount_;  // (число строк, столбец)
+    size_t activeRows_ = 0;
+    size_t activeCols_ = 0;
+    size_t activeNnz_ = 0;
+    Echelon result_;
+};
+
+// Обратная подстановка для k правых частей: x (cols x k) содержит значения
+// свободных переменных, ведущие переменные вычисляются от последней строки
+void backSubstitute(const Field& field, const Echelon& e, std::vector<uint64_t>& x, size_t k) {
+    for (size_t t = e.pivotCols.size(); t-- > 0;) {
+        uint64_t* target = x.data() + e.pivotCols[t] * k;
+        for (const Entry& entry : e.pivotRows[t]) {
+            if (entry.col == e.pivotCols[t]) {
+                continue;
+            }
+            const uint64_t* src = x.data() + entry.col * k;
+            uint64_t f = field.neg(entry.value);
+            for (size_t j = 0; j < k; ++j) {
+                target[j] = field.add(target[j], field.mul(f, src[j]));
+            }
+        }
+    }
+}
+
+// Структурированное исключение A (с правой частью rhs, если задана)
+Echelon structuredEchelon(const SparseMatrix& a, const uint64_t* rhs,
+                          const EliminationOptions& options) {
+    StructuredElimination elimination(a.field(), a.rows(), a.cols());
+    const auto& rowPtr = a.rowPointers();
+    for (size_t i = 0; i < a.rows(); ++i) {
+        SparseRow row;
+        row.reserve(rowPtr[i + 1] - rowPtr[i]);
+        for (size_t s = rowPtr[i]; s < rowPtr[i + 1]; ++s) {
+            row.push_back({a.columnIndices()[s], a.values()[s]});
+        }
+        elimination.setRow(i, std::move(row), rhs ? rhs[i] : 0);
+    }
+    elimination.eliminateSparse();
+    elimination.eliminateDense(options, rhs != nullptr);
+    return std::move(elimination.result());
+}
+
+} // namespace
+
+SparseMatrix::SparseMatrix(size_t rows, size_t cols, const Field& field)
+    : rows_(rows), cols_(cols), field_(&field), rowPtr_(rows + 1, 0) {}
+
+SparseMatrix::SparseMatrix(size_t rows, size_t cols, const Field& field,
+                           const std::vector<SparseEntry>& entries)
+    : SparseMatrix(rows, cols, field) {
+    std::vector<std::pair<std::pair<size_t, size_t>, uint64_t>> sorted;
+    sorted.reserve(entries.size());
+    for (const SparseEntry& e : entries) {
+        if (e.row >= rows || e.col >= cols) {
+            throw std::out_of_range("Индекс вне границ матрицы");
+        }
+        if (&e.value.field() != field_) {
+            throw std::invalid_argument("Элемент задан над другим полем");
+        }
+        sorted.push_back({{e.row, e.col}, e.value.raw()});
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    for (size_t s = 0; s < sorted.size();) {
+        auto position = sorted[s].first;
+        uint64_t value = 0;
+        for (; s < sorted.size() && sorted[s].first == position; ++s) {
+            value = field.add(value, sorted[s].second);
+        }
+        if (value != 0) {
+            ++rowPtr_[position.first + 1];
+            colIndex_.push_back(position.second);
+            values_.push_back(value);
+        }
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        rowPtr_[i + 1] += rowPtr_[i];
+    }
+}
+
+SparseMatrix SparseMatrix::fromMatrix(const Matrix& mat) {
+    SparseMatrix result(mat.rows(), mat.cols(), mat.field());
+    for (size_t i = 0; i < mat.rows(); ++i) {
+        const GFElement* row = mat.rowData(i);
+        for (size_t j = 0; j < mat.cols(); ++j) {
+            if (row[j].raw() != 0) {
+                result.colIndex_.push_back(j);
+                result.values_.push_back(row[j].raw());
+            }
+        }
+        result.rowPtr_[i + 1] = result.colIndex_.size();
+    }
+    return result;
+}
+
+Matrix SparseMatrix::toMatrix() const {
+    Matrix result(rows_, cols_, *field_);
+    for (size_t i = 0; i < rows_; ++i) {
+        GFElement* row = result.rowData(i);
+        for (size_t s = rowPtr_[i]; s < rowPtr_[i + 1]; ++s) {
+            row[colIndex_[s]] = GFElement::fromRaw(*field_, values_[s]);
+        }
+    }
+    return result;
+}
+
+GFElement SparseMatrix::get(size_t i, size_t j) const {
+    if (i >= rows_ || j >= cols_) {
+        throw std::out_of_range("Индекс вне границ матрицы");
+    }
+    auto first = colIndex_.begin() + rowPtr_[i];
+    auto last = colIndex_.begin() + rowPtr_[i + 1];
+    auto it = std::lower_bound(first, last, j);
+    if (it == last || *it != j) {
+        return GFElement(*field_);
+    }
+    return GFElement::fromRaw(*field_, values_[it - colIndex_.begin()]);
+}
+
+SparseMatrix SparseMatrix::transpose() const {
+    SparseMatrix result(cols_, rows_, *field_);
+    for (size_t j : colIndex_) {
+        ++result.rowPtr_[j + 1];
+    }
+    for (size_t j = 0; j < cols_; ++j) {
+        result.rowPtr_[j + 1] += result.rowPtr_[j];
+    }
+    result.colIndex_.resize(colIndex_.size());
+    result.values_.resize(values_.size());
+    std::vector<size_t> next(result.rowPtr_.begin(), result.rowPtr_.end() - 1);
+    for (size_t i = 0; i < rows_; ++i) {
+        for (size_t s = rowPtr_[i]; s < rowPtr_[i + 1]; ++s) {
+            size_t pos = next[colIndex_[s]]++;
+            result.colIndex_[pos] = i;
+            result.values_[pos] = values_[s];
+        }
+    }
+    return result;
+}
+
+std::vector<GFElement> SparseMatrix::operator*(const std::vector<GFElement>& vec) const {
+    if (vec.size() != cols_) {
+        throw std::invalid_argument("Размер вектора не совпадает с количеством столбцов");
+    }
+    const Field& field = *field_;
+    std::vector<GFElement> result;
+    result.reserve(rows_);
+    for (size_t i = 0; i < rows_; ++i) {
+        uint64_t sum = 0;
+        for (size_t s = rowPtr_[i]; s < rowPtr_[i + 1]; ++s) {
+            sum = field.add(sum, field.mul(values_[s], vec[colIndex_[s]].raw()));
+        }
+        result.push_back(GFElement::fromRaw(field, sum));
+    }
+    return result;
+}
+
+size_t SparseMatrix::rank(const EliminationOptions& options) const {
+    // У широкой матрицы ведущие строки плотной части длиной почти в cols;
+    // ранг транспонированной тот же, а её строки короче
+    if (cols_ > rows_) {
+        return structuredEchelon(transpose(), nullptr, options).pivotCols.size();
+    }
+    return structuredEchelon(*this, nullptr, options).pivotCols.size();
+}
+
+std::optional<std::vector<GFElement>> SparseMatrix::solve(
+    const std::vector<GFElement>& b, const EliminationOptions& options) const {
+    if (b.size() != rows_) {
+        throw std::invalid_argument("Размер правой части не совпадает с числом строк");
+    }
+    std::vector<uint64_t> packed(rows_);
+    for (size_t i = 0; i < rows_; ++i) {
+        if (&b[i].field() != field_) {
+            throw std::invalid_argument("Правая часть задана над другим полем");
+        }
+        packed[i] = b[i].raw();
+    }
+
+    Echelon e = structuredEchelon(*this, packed.data(), options);
+    if (!e.consistent) {
+        return std::nullopt;
+    }
+    std::vector<uint64_t> x(cols_, 0);
+    for (size_t t = 0; t < e.pivotCols.size(); ++t) {
+        x[e.pivotCols[t]] = e.rhs[t];
+    }
+    backSubstitute(*field_, e, x, 1);
+
+    std::vector<GFElement> result;
+    result.reserve(cols_);
+    for (uint64_t value : x) {
+        result.push_back(GFElement::fromRaw(*field_, value));
+    }
+    return result;
+}
+
+Matrix SparseMatrix::nullspace(const EliminationOptions& options) const {
+    Echelon e = structuredEchelon(*this, nullptr, options);
+    std::vector<bool> isPivot(cols_, false);
+    for (size_t col : e.pivotCols) {
+        isPivot[col] = true;
+    }
+
+    // Для свободного столбца f: x_f = 1 в своём столбце базиса
+    size_t k = cols_ - e.pivotCols.size();
+    std::vector<uint64_t> x(cols_ * k, 0);
+    for (size_t j = 0, t = 0; j < cols_; ++j) {
+        if (!isPivot[j]) {
+            x[j * k + t++] = 1;
+        }
+    }
+    backSubstitute(*field_, e, x, k);
+
+    Matrix result(cols_, k, *field_);
+    for (size_t i = 0; i < cols_; ++i) {
+        GFElement* row = result.rowData(i);
+        for (size_t t = 0; t < k; ++t) {
+            row[t] = GFElement::fromRaw(*field_, x[i * k + t]);
+        }
+    }
+    return result;
+}
+
+bool SparseMatrix::operator==(const SparseMatrix& other) const {
+    return rows_ == other.rows_ && cols_ == other.cols_ && field_ == other.field_ &&
+           rowPtr_ == other.rowPtr_ && colIndex_ == other.colIndex_ &&
+           values_ == other.values_;
+}
+
+bool SparseMatrix::operator!=(const SparseMatrix& other) const {
+    return !(*this == other);
+}
+
+} // namespace matrix_gf2
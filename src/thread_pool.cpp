@@ -0,0 +1,157 @@
+#include "../include/matrix_gf2/thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+
+namespace matrix_gf2 {
+
+// Один вызов parallelFor: индексы раздаются по счётчику next
+struct ThreadPool::Job {
+    const std::function<void(size_t)>* task;
+    size_t count;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> finished{0};
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+};
+
+namespace {
+
+std::mutex& globalMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+size_t& globalSize() {
+    static size_t size = 0;
+    return size;
+}
+
+std::unique_ptr<ThreadPool>& globalPool() {
+    static std::unique_ptr<ThreadPool> pool;
+    return pool;
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t threads) {
+    if (threads == 0) {
+        threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(threads - 1);
+    for (size_t i = 1; i < threads; ++i) {
+        workers_.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::runJob(Job& job) {
+    for (;;) {
+        size_t i = job.next.fetch_add(1);
+        if (i >= job.count) {
+            return;
+        }
+        try {
+            (*job.task)(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(job.mutex);
+            if (!job.error) {
+                job.error = std::current_exception();
+            }
+        }
+        if (job.finished.fetch_add(1) + 1 == job.count) {
+            std::lock_guard<std::mutex> lock(job.mutex);
+            job.done.notify_all();
+        }
+    }
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            // Полностью розданные задания больше не нужны в очереди
+            if (queue_.front()->next.load() >= queue_.front()->count) {
+                queue_.pop_front();
+                continue;
+            }
+            job = queue_.front();
+        }
+        runJob(*job);
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& task) {
+    if (count == 0) {
+        return;
+    }
+    if (workers_.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->task = &task;
+    job->count = count;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(job);
+    }
+    wake_.notify_all();
+
+    // Вызывающий поток работает наравне с рабочими
+    runJob(*job);
+    {
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->done.wait(lock, [&job] { return job->finished.load() == job->count; });
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = std::find(queue_.begin(), queue_.end(), job);
+        if (it != queue_.end()) {
+            queue_.erase(it);
+        }
+    }
+
+    if (job->error) {
+        std::rethrow_exception(job->error);
+    }
+}
+
+ThreadPool& ThreadPool::global() {
+    std::lock_guard<std::mutex> lock(globalMutex());
+    auto& pool = globalPool();
+    if (!pool) {
+        pool = std::make_unique<ThreadPool>(globalSize());
+    }
+    return *pool;
+}
+
+void ThreadPool::setGlobalSize(size_t threads) {
+    std::lock_guard<std::mutex> lock(globalMutex());
+    if (globalPool()) {
+        throw std::runtime_error("Общий пул потоков уже создан");
+    }
+    globalSize() = threads;
+}
+
+} // namespace matrix_gf2
@@ -0,0 +1,233 @@
+#include "../include/matrix_gf2/wiedemann.hpp"
+#include "../include/matrix_gf2/thread_pool.hpp"
+#include "gemm_prime.hpp"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+
+namespace matrix_gf2 {
+
+namespace {
+
+// Умножение делится между потоками от kParallelNonZeros ненулевых элементов
+constexpr size_t kParallelNonZeros = size_t(1) << 16;
+
+// Глубина отложенного приведения для GF(p), p <= 2^32 (0 - поэлементная
+// арифметика поля)
+uint64_t reductionDepth(const Field& field) {
+    return detail::supportsDelayedReduction(field) ? detail::delayedReductionDepth(field.p()) : 0;
+}
+
+// sum a[s] * b[index ? index[s] : s], s < count
+uint64_t dot(const Field& field, uint64_t depth, const uint64_t* a, const uint64_t* b,
+             const size_t* index, size_t count) {
+    if (depth == 0) {
+        uint64_t sum = 0;
+        for (size_t s = 0; s < count; ++s) {
+            sum = field.add(sum, field.mul(a[s], b[index ? index[s] : s]));
+        }
+        return sum;
+    }
+    // Произведения складываются в uint64_t и приводятся раз в depth слагаемых
+    uint64_t p = field.p();
+    uint64_t sum = 0;
+    uint64_t pending = 0;
+    for (size_t s = 0; s < count; ++s) {
+        if (pending == depth) {
+            sum %= p;
+            pending = 1;
+        }
+        sum += a[s] * b[index ? index[s] : s];
+        ++pending;
+    }
+    return sum % p;
+}
+
+// y = A * x над упакованными значениями, параллельно по строкам
+void multiplyPacked(const SparseMatrix& a, const uint64_t* x, uint64_t* y, ThreadPool* pool) {
+    const Field& field = a.field();
+    uint64_t depth = reductionDepth(field);
+    const auto& rowPtr = a.rowPointers();
+    const size_t* colIndex = a.columnIndices().data();
+    const uint64_t* values = a.values().data();
+    auto rowsRange = [&](size_t from, size_t to) {
+        for (size_t i = from; i < to; ++i) {
+            y[i] = dot(field, depth, values + rowPtr[i], x, colIndex + rowPtr[i],
+                       rowPtr[i + 1] - rowPtr[i]);
+        }
+    };
+
+    size_t rows = a.rows();
+    if (a.nonZeros() < kParallelNonZeros) {
+        rowsRange(0, rows);
+        return;
+    }
+    ThreadPool& threads = pool ? *pool : ThreadPool::global();
+    if (threads.size() == 1) {
+        rowsRange(0, rows);
+        return;
+    }
+    size_t tasks = threads.size() * 4;
+    size_t chunk = (rows + tasks - 1) / tasks;
+    threads.parallelFor((rows + chunk - 1) / chunk, [&](size_t t) {
+        rowsRange(t * chunk, std::min(rows, (t + 1) * chunk));
+    });
+}
+
+// Берлекэмп-Мэсси: минимальный многочлен f (f[L] = 1), sum f_j s_{i+j} = 0
+std::vector<uint64_t> minimalPolynomial(const Field& field, const std::vector<uint64_t>& s) {
+    // C(z) = 1 + c_1 z + ... + c_L z^L: s_n + sum c_i s_{n-i} = 0
+    std::vector<uint64_t> c{1};
+    std::vector<uint64_t> prev{1};
+    size_t length = 0;
+    size_t shift = 1;
+    uint64_t prevDiscrepancy = 1;
+
+    for (size_t n = 0; n < s.size(); ++n) {
+        uint64_t d = s[n];
+        for (size_t i = 1; i <= length && i < c.size(); ++i) {
+            d = field.add(d, field.mul(c[i], s[n - i]));
+        }
+        if (d == 0) {
+            ++shift;
+            continue;
+        }
+
+        // C -= d / b * z^shift * B
+        uint64_t factor = field.neg(field.mul(d, field.inv(prevDiscrepancy)));
+        std::vector<uint64_t> saved = c;
+        if (c.size() < prev.size() + shift) {
+            c.resize(prev.size() + shift, 0);
+        }
+        for (size_t i = 0; i < prev.size(); ++i) {
+            c[i + shift] = field.add(c[i + shift], field.mul(factor, prev[i]));
+        }
+        if (2 * length <= n) {
+            length = n + 1 - length;
+            prev = std::move(saved);
+            prevDiscrepancy = d;
+            shift = 1;
+        } else {
+            ++shift;
+        }
+    }
+
+    c.resize(length + 1, 0);
+    std::reverse(c.begin(), c.end());
+    return c;
+}
+
+} // namespace
+
+std::vector<GFElement> berlekampMassey(const std::vector<GFElement>& sequence) {
+    const Field& field = sequence.empty() ? Field::get(2) : sequence[0].field();
+    std::vector<uint64_t> packed;
+    packed.reserve(sequence.size());
+    for (const GFElement& e : sequence) {
+        if (&e.field() != &field) {
+            throw std::invalid_argument("Элементы последовательности заданы над разными полями");
+        }
+        packed.push_back(e.raw());
+    }
+
+    std::vector<GFElement> result;
+    for (uint64_t value : minimalPolynomial(field, packed)) {
+        result.push_back(GFElement::fromRaw(field, value));
+    }
+    return result;
+}
+
+std::optional<std::vector<GFElement>> wiedemannSolve(const SparseMatrix& a,
+                                                     const std::vector<GFElement>& b,
+                                                     const WiedemannOptions& options) {
+    if (a.rows() != a.cols()) {
+        throw std::invalid_argument("Метод Видемана требует квадратной матрицы");
+    }
+    size_t n = a.rows();
+    if (b.size() != n) {
+        throw std::invalid_argument("Размер правой части не совпадает с числом строк");
+    }
+    const Field& field = a.field();
+    std::vector<uint64_t> residual(n);
+    for (size_t i = 0; i < n; ++i) {
+        if (&b[i].field() != &field) {
+            throw std::invalid_argument("Правая часть задана над другим полем");
+        }
+        residual[i] = b[i].raw();
+    }
+
+    uint64_t depth = reductionDepth(field);
+    std::mt19937_64 gen(options.seed != 0 ? options.seed : std::random_device()());
+    std::uniform_int_distribution<uint64_t> dist(0, field.maxValue());
+    auto isZero = [](const std::vector<uint64_t>& v) {
+        return std::all_of(v.begin(), v.end(), [](uint64_t e) { return e == 0; });
+    };
+
+    // Невязка r = b - A x аннулируется многочленом степени не выше bound
+    std::vector<uint64_t> x(n, 0);
+    std::vector<uint64_t> u(n);
+    std::vector<uint64_t> v(n);
+    std::vector<uint64_t> w(n);
+    size_t bound = n;
+    for (size_t projection = 0; projection < options.maxProjections && !isZero(residual);
+         ++projection) {
+        for (uint64_t& e : u) {
+            e = dist(gen);
+        }
+
+        // s_i = u^T A^i r, 2 * bound членов
+        std::vector<uint64_t> sequence(2 * bound);
+        v = residual;
+        for (size_t i = 0; i < sequence.size(); ++i) {
+            sequence[i] = dot(field, depth, u.data(), v.data(), nullptr, n);
+            if (i + 1 < sequence.size()) {
+                multiplyPacked(a, v.data(), w.data(), options.pool);
+                v.swap(w);
+            }
+        }
+
+        std::vector<uint64_t> f = minimalPolynomial(field, sequence);
+        size_t degree = f.size() - 1;
+        if (degree == 0) {
+            continue;  // Проекция ортогональна последовательности
+        }
+        if (f[0] == 0) {
+            return std::nullopt;
+        }
+
+        // f(z) = f_0 + z g(z): y = -g(A) r / f_0 (схема Горнера)
+        std::vector<uint64_t> y = residual;
+        std::transform(y.begin(), y.end(), y.begin(),
+                       [&](uint64_t e) { return field.mul(e, f[degree]); });
+        for (size_t j = degree - 1; j-- > 0;) {
+            multiplyPacked(a, y.data(), w.data(), options.pool);
+            for (size_t i = 0; i < n; ++i) {
+                y[i] = field.add(w[i], field.mul(f[j + 1], residual[i]));
+            }
+        }
+        uint64_t scale = field.neg(field.inv(f[0]));
+        for (size_t i = 0; i < n; ++i) {
+            y[i] = field.mul(y[i], scale);
+            x[i] = field.add(x[i], y[i]);
+        }
+
+        // r -= A y = f(A) r / f_0: её многочлен - частное от деления на f
+        multiplyPacked(a, y.data(), w.data(), options.pool);
+        for (size_t i = 0; i < n; ++i) {
+            residual[i] = field.sub(residual[i], w[i]);
+        }
+        bound = bound > degree ? bound - degree : 1;
+    }
+
+    if (!isZero(residual)) {
+        return std::nullopt;
+    }
+    std::vector<GFElement> result;
+    result.reserve(n);
+    for (uint64_t value : x) {
+        result.push_back(GFElement::fromRaw(field, value));
+    }
+    return result;
+}
+
+} // namespace matrix_gf2
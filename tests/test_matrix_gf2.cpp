@@ -1,6 +1,23 @@
 #include "../include/matrix_gf2/matrix.hpp"
+#include "../include/matrix_gf2/bit_matrix.hpp"
+#include "../include/matrix_gf2/binary_field.hpp"
+#include "../include/matrix_gf2/region_ops.hpp"
+#include "../include/matrix_gf2/static_matrix.hpp"
+#include "../include/matrix_gf2/thread_pool.hpp"
+#include "../include/matrix_gf2/pluq.hpp"
+#include "../include/matrix_gf2/solve.hpp"
+#include "../include/matrix_gf2/sparse_matrix.hpp"
+#include "../include/matrix_gf2/wiedemann.hpp"
+#include "../include/matrix_gf2/incremental_echelon.hpp"
+#include "../include/matrix_gf2/inverse_tracker.hpp"
 #include <iostream>
 #include <cassert>
+#include <random>
+#include <bitset>
+#include <atomic>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
 
 using namespace matrix_gf2;
 
@@ -161,6 +178,30 @@ void testMatrixInverse() {
     auto invB = B.inverse(false);
     assert(!invB.has_value());
     
+    // Тест 4: Обращение на месте совпадает с обращением через [A | I]
+    std::vector<uint32_t> mod8 = {1, 0, 1, 1, 1, 0, 0, 0, 1};
+    for (int k = 0; k < 3; ++k) {
+        uint64_t p = k == 0 ? 7 : 2;
+        uint32_t m = k == 1 ? 8 : 1;
+        std::vector<uint32_t> modulus = k == 1 ? mod8 : std::vector<uint32_t>{1, 1};
+        Matrix M = Matrix::random(60, 60, p, m, modulus);
+        while (!M.isInvertible()) {
+            M = Matrix::random(60, 60, p, m, modulus);
+        }
+        Matrix inv = M;
+        assert(inv.invertInPlace());
+        assert(inv == *M.inverse(EliminationOptions()));
+        assert(M * inv == Matrix::identity(60, p, m, modulus));
+    }
+    
+    // Тест 5: Вырожденная и неквадратная матрицы
+    Matrix singular({{1, 2, 3}, {2, 4, 6}, {0, 1, 1}}, 7, 1);
+    assert(!singular.invertInPlace());
+    Matrix binarySingular = B;
+    assert(!binarySingular.invertInPlace() && binarySingular == B);
+    Matrix wide(2, 3, 7, 1);
+    assert(!wide.invertInPlace());
+    
     std::cout << "  ✓ Все тесты обратной матрицы пройдены\n";
 }
 
@@ -201,6 +242,58 @@ void testSubmatrix() {
     assert(sub(1, 0).isZero());
     assert(sub(1, 1).getValue() == 1);
     
+    // Обратимая подматрица: совпадает с первой найденной полным перебором
+    auto bruteForce = [](const Matrix& m) -> std::optional<SubmatrixInfo> {
+        for (size_t size = std::min(m.rows(), m.cols()); size >= 1; --size) {
+            std::vector<bool> rowSelector(m.rows(), false);
+            std::fill(rowSelector.begin(), rowSelector.begin() + size, true);
+            do {
+                std::vector<size_t> rows;
+                for (size_t i = 0; i < m.rows(); ++i) {
+                    if (rowSelector[i]) rows.push_back(i);
+                }
+                std::vector<bool> colSelector(m.cols(), false);
+                std::fill(colSelector.begin(), colSelector.begin() + size, true);
+                do {
+                    std::vector<size_t> cols;
+                    for (size_t j = 0; j < m.cols(); ++j) {
+                        if (colSelector[j]) cols.push_back(j);
+                    }
+                    Matrix candidate = m.submatrix(rows, cols);
+                    if (candidate.isInvertible()) {
+                        SubmatrixInfo info(candidate);
+                        info.rows = rows;
+                        info.cols = cols;
+                        return info;
+                    }
+                } while (std::prev_permutation(colSelector.begin(), colSelector.end()));
+            } while (std::prev_permutation(rowSelector.begin(), rowSelector.end()));
+        }
+        return std::nullopt;
+    };
+    for (int trial = 0; trial < 20; ++trial) {
+        Matrix M = Matrix::random(4 + trial % 3, 6 - trial % 3, trial % 2 ? 2 : 3);
+        // Неполный ранг: последняя строка - сумма первых двух
+        for (size_t j = 0; j < M.cols() && trial % 4 == 0; ++j) {
+            M(M.rows() - 1, j) = M(0, j) + M(1, j);
+        }
+        auto fast = M.findInvertibleSubmatrix();
+        auto expected = bruteForce(M);
+        assert(fast.has_value() == expected.has_value());
+        if (fast) {
+            assert(fast->rows == expected->rows);
+            assert(fast->cols == expected->cols);
+            assert(fast->submatrix == expected->submatrix);
+        }
+    }
+    assert(!Matrix(3, 4, 5, 1).findInvertibleSubmatrix());
+    
+    // Большая матрица неполного ранга
+    Matrix big = Matrix::random(200, 80, 65521) * Matrix::random(80, 150, 65521);
+    auto info = big.findInvertibleSubmatrix();
+    assert(info && info->rows.size() == 80 && info->cols.size() == 80);
+    assert(info->submatrix.isInvertible());
+    
     std::cout << "  ✓ Все тесты подматриц пройдены\n";
 }
 
@@ -231,6 +324,1212 @@ void testRowOperations() {
     std::cout << "  ✓ Все тесты операций со строками пройдены\n";
 }
 
+void testMatrixStorage() {
+    std::cout << "Тестирование хранения матриц...\n";
+    
+    // Тест 1: Строки выровнены по кэш-линии
+    Matrix A = Matrix::random(7, 5, 5);
+    assert(A.stride() >= A.cols() && A.stride() * sizeof(GFElement) % 64 == 0);
+    for (size_t i = 0; i < A.rows(); ++i) {
+        assert(reinterpret_cast<uintptr_t>(A.rowData(i)) % 64 == 0);
+        for (size_t j = 0; j < A.cols(); ++j) {
+            assert(A.rowData(i)[j] == A(i, j));
+        }
+    }
+    
+    // Тест 2: Перестановка строк через таблицу индексов
+    Matrix B = A;
+    B.swapRows(0, 6);
+    B.swapRows(2, 3);
+    assert(B.getRow(0) == A.getRow(6) && B.getRow(6) == A.getRow(0));
+    assert(B.getRow(2) == A.getRow(3) && B.getRow(3) == A.getRow(2));
+    assert(B != A);
+    B.swapRows(2, 3);
+    B.swapRows(0, 6);
+    assert(B == A);
+    
+    // Тест 3: Копия не зависит от исходной матрицы
+    Matrix C = B;
+    C.swapRows(1, 4);
+    C(1, 0) = GFElement(3, 5, 1);
+    assert(B == A);
+    assert(C(1, 0).getValue() == 3 && C.getRow(4) == A.getRow(1));
+    
+    std::cout << "  ✓ Все тесты хранения матриц пройдены\n";
+}
+
+void testMatrixViews() {
+    std::cout << "Тестирование представлений матриц...\n";
+    
+    // Тест 1: Строка, столбец и блок ссылаются на буфер матрицы
+    Matrix A = Matrix::random(9, 7, 11);
+    Matrix original = A;
+    RowView r = A.row(2);
+    ColumnView c = A.col(3);
+    assert(r.size() == 7 && c.size() == 9);
+    assert(r.toVector() == A.getRow(2) && c.toVector() == A.getCol(3));
+    r[1] = GFElement(A.field(), 5);
+    c[4] = GFElement(A.field(), 6);
+    assert(A(2, 1).getValue() == 5 && A(4, 3).getValue() == 6);
+    
+    MatrixView blk = A.block(1, 2, 4, 3);
+    blk(0, 0) = GFElement(A.field(), 7);
+    assert(A(1, 2).getValue() == 7);
+    assert(blk.toMatrix() == A.submatrix({1, 2, 3, 4}, {2, 3, 4}));
+    assert(blk.block(1, 1, 2, 2) == A.block(2, 3, 2, 2));
+    
+    // Тест 2: Ленивое транспонирование и блоки транспонированного
+    ConstMatrixView t = original.view().transposed();
+    assert(t.rows() == 7 && t.cols() == 9);
+    assert(Matrix(t) == original.transpose());
+    assert(t.block(2, 1, 3, 5) == original.transpose().block(2, 1, 3, 5));
+    assert(Matrix(t.transposed()) == original);
+    
+    // Тест 3: Операции принимают представления (в том числе над GF(2))
+    std::vector<uint32_t> mod8 = {1, 0, 1, 1, 1, 0, 0, 0, 1};
+    for (int k = 0; k < 3; ++k) {
+        uint64_t p = k == 0 ? 11 : 2;
+        uint32_t m = k == 1 ? 8 : 1;
+        std::vector<uint32_t> modulus = k == 1 ? mod8 : std::vector<uint32_t>{1, 1};
+        Matrix X = Matrix::random(40, 30, p, m, modulus);
+        Matrix Y = Matrix::random(40, 50, p, m, modulus);
+        ConstMatrixView xt = X.view().transposed();
+        assert(xt * Y == X.transpose() * Y);
+        assert(multiply(X.block(5, 0, 20, 30), Y.block(0, 10, 30, 25)) ==
+               Matrix(X.block(5, 0, 20, 30)) * Matrix(Y.block(0, 10, 30, 25)));
+        assert(X.block(0, 0, 30, 30) + xt.block(0, 0, 30, 30) ==
+               Matrix(X.block(0, 0, 30, 30)) + X.transpose().block(0, 0, 30, 30));
+        assert(X.block(0, 0, 30, 30) - xt.block(0, 10, 30, 30) ==
+               Matrix(X.block(0, 0, 30, 30)) - Matrix(X.transpose().block(0, 10, 30, 30)));
+        std::vector<GFElement> v = Y.getCol(0);
+        assert(xt * v == X.transpose() * v);
+    }
+    
+    // Тест 4: Запись в блок и перестановка строк
+    Matrix B(6, 6, 11, 1);
+    B.block(3, 0, 3, 6).assign(original.block(0, 1, 3, 6));
+    B.block(0, 0, 3, 3).assign(original.view().transposed().block(0, 0, 3, 3));
+    assert(B.block(3, 0, 3, 6) == original.block(0, 1, 3, 6));
+    assert(B(0, 1) == original(1, 0));
+    ConstMatrixView whole = B.view();
+    B.swapRows(0, 3);
+    assert(whole(0, 1) == original(0, 2));
+    
+    // Тест 5: Проверка границ
+    bool thrown = false;
+    try {
+        A.block(5, 0, 5, 1);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        t.at(7, 0);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        A.row(9);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "  ✓ Все тесты представлений матриц пройдены\n";
+}
+
+void testField() {
+    std::cout << "Тестирование контекста поля...\n";
+    
+    // Тест 1: Контекст поля создаётся один раз
+    GFElement a(1, 3, 1, {1, 1});
+    GFElement b(2, 3, 1);
+    assert(&a.field() == &b.field());
+    assert(&a.field() == &Field::get(3));
+    
+    // Тест 2: Элемент не содержит динамических данных
+    assert(sizeof(GFElement) <= 2 * sizeof(uint64_t));
+    
+    // Тест 3: GF(4) с модулем x^2 + x + 1: x * x = x + 1
+    const Field& gf4 = Field::get(2, 2, {1, 1, 1});
+    GFElement x(gf4, 2);
+    GFElement x2 = x * x;
+    assert(x2.getValue() == 3);
+    assert((x * x.inverse()).isOne());
+    
+    // Тест 4: Приведение коэффициентов по модулю
+    GFElement c({0, 0, 1}, 2, 2, {1, 1, 1});
+    assert(c == x2);
+    
+    // Тест 5: Матрица над GF(4)
+    Matrix M(2, 2, gf4);
+    M(0, 0) = x;
+    M(1, 1) = x;
+    auto invM = M.inverse(false);
+    assert(invM.has_value());
+    assert(M * (*invM) == Matrix::identity(2, 2, 2, {1, 1, 1}));
+    
+    std::cout << "  ✓ Все тесты контекста поля пройдены\n";
+}
+
+void testLogTables() {
+    std::cout << "Тестирование табличной арифметики...\n";
+    
+    // Тест 1: GF(9) = GF(3)[x] / (x^2 + 1), сравнение с формулами
+    const Field& gf9 = Field::get(3, 2, {1, 0, 1});
+    assert(gf9.hasLogTables());
+    for (uint64_t a = 0; a < 9; ++a) {
+        for (uint64_t b = 0; b < 9; ++b) {
+            uint64_t a0 = a % 3, a1 = a / 3, b0 = b % 3, b1 = b / 3;
+            uint64_t prod = (a0 * b0 + 2 * a1 * b1) % 3 + 3 * ((a0 * b1 + a1 * b0) % 3);
+            uint64_t sum = (a0 + b0) % 3 + 3 * ((a1 + b1) % 3);
+            uint64_t diff = (a0 + 3 - b0) % 3 + 3 * ((a1 + 3 - b1) % 3);
+            assert(gf9.mul(a, b) == prod);
+            assert(gf9.add(a, b) == sum);
+            assert(gf9.sub(a, b) == diff);
+        }
+    }
+    
+    // Тест 2: GF(2^8) с модулем x^8 + x^4 + x^3 + x^2 + 1
+    const Field& gf256 = Field::get(2, 8, {1, 0, 1, 1, 1, 0, 0, 0, 1});
+    assert(gf256.hasLogTables());
+    for (uint64_t a = 1; a < 256; ++a) {
+        assert(gf256.mul(a, gf256.inv(a)) == 1);
+        assert(gf256.div(a, a) == 1);
+    }
+    assert(gf256.mul(2, 128) == 0x1D);
+    
+    // Тест 3: Приводимый модуль - таблицы не строятся
+    const Field& ring = Field::get(2, 2, {1, 0, 1});
+    assert(!ring.hasLogTables());
+    
+    std::cout << "  ✓ Все тесты табличной арифметики пройдены\n";
+}
+
+void testPrimeInverse() {
+    std::cout << "Тестирование обратных элементов GF(p)...\n";
+    
+    // Тест 1: Таблица обратных для p = 65521
+    const Field& f = Field::get(65521);
+    for (uint64_t a = 1; a < 65521; ++a) {
+        assert(f.mul(a, f.inv(a)) == 1);
+    }
+    
+    // Тест 2: Расширенный алгоритм Евклида для большого p
+    const Field& big = Field::get(2147483647u);
+    for (uint64_t a : {uint64_t(1), uint64_t(2), uint64_t(12345), uint64_t(2147483646)}) {
+        assert(big.mul(a, big.inv(a)) == 1);
+    }
+    
+    // Тест 3: Обратная матрица над GF(65521)
+    Matrix A({{3, 7}, {11, 65520}}, 65521, 1);
+    auto invA = A.inverse(false);
+    assert(invA.has_value());
+    assert(A * (*invA) == Matrix::identity(2, 65521, 1));
+    
+    std::cout << "  ✓ Все тесты обратных элементов GF(p) пройдены\n";
+}
+
+void testLargePrimeFields() {
+    std::cout << "Тестирование больших простых полей...\n";
+    
+    // Тест 1: Умножение по модулю 2^31 - 1 и 2^61 - 1 (сравнение с долгим делением)
+    std::mt19937_64 gen(42);
+    for (uint64_t p : {uint64_t(2147483647u), (uint64_t(1) << 61) - 1, uint64_t(65521)}) {
+        const Field& f = Field::get(p);
+        for (int iter = 0; iter < 1000; ++iter) {
+            uint64_t a = gen() % p;
+            uint64_t b = gen() % p;
+            // Эталон: умножение сложениями с удвоением
+            uint64_t expected = 0;
+            for (uint64_t x = a, y = b; y > 0; y >>= 1) {
+                if (y & 1) expected = (expected + x) % p;
+                x = (x + x) % p;
+            }
+            assert(f.mul(a, b) == expected);
+            assert(f.add(a, b) == (a + b) % p);
+        }
+        assert(f.mul(p - 1, p - 1) == 1);
+    }
+    
+    // Тест 2: Обратная матрица над GF(2^61 - 1)
+    const Field& f61 = Field::get((uint64_t(1) << 61) - 1);
+    Matrix A(2, 2, f61);
+    A(0, 0) = GFElement(f61, 123456789012345ull);
+    A(0, 1) = GFElement(f61, 987654321ull);
+    A(1, 0) = GFElement(f61, 5);
+    A(1, 1) = GFElement(f61, (uint64_t(1) << 60) + 7);
+    auto invA = A.inverse(false);
+    assert(invA.has_value());
+    Matrix I = A * (*invA);
+    assert(I(0, 0).isOne() && I(1, 1).isOne());
+    assert(I(0, 1).isZero() && I(1, 0).isZero());
+    assert(A.getP() == (uint64_t(1) << 61) - 1);
+    
+    // Тест 4: GF(p^2) с p чуть меньше 2^32 - сумма цифр не помещается в 32 бита
+    uint64_t q = 4294967291ULL;
+    const Field& big2 = Field::get(q, 2, {1, 0, 1});
+    assert(big2.add(q - 1, q - 1) == q - 2);
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<uint64_t> dist(0, big2.maxValue());
+    for (int k = 0; k < 1000; ++k) {
+        uint64_t a = dist(rng);
+        uint64_t b = dist(rng);
+        assert(big2.sub(big2.add(a, b), b) == a);
+        assert(big2.add(a, big2.neg(a)) == 0);
+        assert(big2.add(a, b) == big2.add(b, a));
+    }
+    
+    std::cout << "  ✓ Все тесты больших простых полей пройдены\n";
+}
+
+void testBinaryExtensionFields() {
+    std::cout << "Тестирование полей GF(2^64) и GF(2^128)...\n";
+    
+    std::mt19937_64 gen(7);
+    
+    // Тест 1: Безпереносное умножение совпадает с побитовым
+    for (int iter = 0; iter < 100; ++iter) {
+        uint64_t a = gen(), b = gen(), hi, lo;
+        detail::clmul64(a, b, hi, lo);
+        uint64_t refHi = 0, refLo = 0;
+        for (int i = 0; i < 64; ++i) {
+            if ((b >> i) & 1) {
+                refLo ^= a << i;
+                if (i > 0) refHi ^= a >> (64 - i);
+            }
+        }
+        assert(hi == refHi && lo == refLo);
+    }
+    
+    // Тест 2: GF(2^64) с модулем x^64 + x^4 + x^3 + x + 1
+    std::vector<uint32_t> mod64(65, 0);
+    mod64[0] = mod64[1] = mod64[3] = mod64[4] = mod64[64] = 1;
+    const Field& f64 = Field::get(2, 64, mod64);
+    for (int iter = 0; iter < 100; ++iter) {
+        uint64_t a = gen(), b = gen();
+        // Эталон: схема Горнера со сдвигами
+        uint64_t ref = 0;
+        for (int i = 63; i >= 0; --i) {
+            bool carry = (ref >> 63) & 1;
+            ref <<= 1;
+            if (carry) ref ^= 0x1B;
+            if ((b >> i) & 1) ref ^= a;
+        }
+        assert(f64.mul(a, b) == ref);
+        if (a != 0) assert(f64.mul(a, f64.inv(a)) == 1);
+    }
+    
+    // Тест 3: GF(2^128): x^127 * x = x^7 + x^2 + x + 1
+    GF2_128 x127(0, uint64_t(1) << 63);
+    GF2_128 x(2, 0);
+    assert(x127 * x == GF2_128(0x87, 0));
+    
+    for (int iter = 0; iter < 20; ++iter) {
+        GF2_128 a(gen(), gen()), b(gen(), gen()), c(gen(), gen());
+        assert(a * (b + c) == a * b + a * c);
+        assert((a * b) * c == a * (b * c));
+        assert((a * a.inverse()).isOne());
+    }
+    
+    std::cout << "  ✓ Все тесты полей GF(2^64) и GF(2^128) пройдены\n";
+}
+
+void testFastMultiplication() {
+    std::cout << "Тестирование быстрого умножения и блочного обращения...\n";
+    
+    MultiplyOptions classic;
+    classic.strassenThreshold = 0;
+    MultiplyOptions strassen;
+    strassen.strassenThreshold = 8;
+    
+    // Тест 1: Штрассен-Виноград совпадает с классическим умножением
+    // (нечётные размеры проверяют отщепление строк и столбцов)
+    std::vector<uint32_t> mod8 = {1, 0, 1, 1, 1, 0, 0, 0, 1};
+    for (auto dims : {std::vector<size_t>{64, 64, 64}, std::vector<size_t>{37, 51, 29},
+                      std::vector<size_t>{100, 33, 81}}) {
+        Matrix A = Matrix::random(dims[0], dims[1], 65521);
+        Matrix B = Matrix::random(dims[1], dims[2], 65521);
+        assert(A.multiply(B, strassen) == A.multiply(B, classic));
+        
+        Matrix C = Matrix::random(dims[0], dims[1], 2, 8, mod8);
+        Matrix D = Matrix::random(dims[1], dims[2], 2, 8, mod8);
+        assert(C.multiply(D, strassen) == C.multiply(D, classic));
+        
+        Matrix E = Matrix::random(dims[0], dims[1], 7, 3, {3, 0, 6, 1});
+        Matrix F = Matrix::random(dims[1], dims[2], 7, 3, {3, 0, 6, 1});
+        assert(E.multiply(F, strassen) == E.multiply(F, classic));
+    }
+    
+    // Тест 2: Блочное обращение больших матриц
+    Matrix A = Matrix::random(150, 150, 7);
+    auto invA = A.inverse();
+    assert(invA.has_value() == A.isInvertible());
+    if (invA) {
+        assert(A * (*invA) == Matrix::identity(150, 7));
+    }
+    
+    // Тест 3: Вырожденный левый верхний блок (переход к методу Гаусса-Жордана)
+    Matrix P(130, 130, 5);
+    for (size_t i = 0; i < 130; ++i) {
+        P(i, (i + 65) % 130) = GFElement(1 + i % 4, 5, 1);
+    }
+    auto invP = P.inverse();
+    assert(invP.has_value());
+    assert(P * (*invP) == Matrix::identity(130, 5));
+    
+    // Тест 4: Вырожденная матрица
+    Matrix S = Matrix::random(140, 140, 65521);
+    S.setRow(139, S.getRow(3));
+    assert(!S.inverse().has_value());
+
+    // Тест 5: Ядра классического умножения над GF(p) против поэлементного
+    // произведения: double с FMA (p < 2^26, в т.ч. с глубиной блока 128),
+    // 64-битные суммы (до 2^30, глубина до 16) и арифметика поля (p около 2^32);
+    // k > 256 - несколько блоков глубины, размеры не кратны плитке микроядра
+    MultiplyOptions integerOnly = classic;
+    integerOnly.floatingPoint = false;
+    for (uint64_t p : {uint64_t(65521), uint64_t(8388593), uint64_t(67108859),
+                       uint64_t(1073741789), uint64_t(4294967291ULL)}) {
+        Matrix X = Matrix::random(70, 300, p);
+        Matrix Y = Matrix::random(300, 75, p);
+        Matrix Z = X.multiply(Y, classic);
+        assert(X.multiply(Y, integerOnly) == Z);
+        for (size_t i = 0; i < 70; i += 9) {
+            for (size_t j = 0; j < 75; j += 7) {
+                GFElement sum(0, p, 1);
+                for (size_t t = 0; t < 300; ++t) {
+                    sum = sum + X(i, t) * Y(t, j);
+                }
+                assert(Z(i, j) == sum);
+            }
+        }
+    }
+
+    std::cout << "  ✓ Все тесты быстрого умножения пройдены\n";
+}
+
+void testThreadPool() {
+    std::cout << "Тестирование пула потоков...\n";
+    
+    ThreadPool pool(4);
+    ThreadPool serial(1);
+    assert(pool.size() == 4);
+    assert(serial.size() == 1);
+    
+    // Тест 1: Каждый индекс выполняется ровно один раз
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallelFor(hits.size(), [&](size_t i) { hits[i].fetch_add(1); });
+    for (auto& h : hits) {
+        assert(h.load() == 1);
+    }
+    
+    // Тест 2: Вложенные вызовы не блокируются
+    std::atomic<size_t> total{0};
+    pool.parallelFor(8, [&](size_t) {
+        pool.parallelFor(8, [&](size_t j) { total.fetch_add(j); });
+    });
+    assert(total.load() == 8 * 28);
+    
+    // Тест 3: Исключение из задачи передаётся вызывающему потоку
+    bool thrown = false;
+    try {
+        pool.parallelFor(16, [](size_t i) {
+            if (i == 5) throw std::runtime_error("ошибка");
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    // Тест 4: Параллельное умножение совпадает с последовательным
+    // (размеры не делятся на плитки, разные ядра умножения)
+    MultiplyOptions parallel;
+    parallel.pool = &pool;
+    MultiplyOptions sequential;
+    sequential.pool = &serial;
+    for (uint64_t p : {uint64_t(65521), uint64_t(4294967291ULL)}) {
+        Matrix A = Matrix::random(301, 260, p);
+        Matrix B = Matrix::random(260, 299, p);
+        assert(A.multiply(B, parallel) == A.multiply(B, sequential));
+    }
+    std::vector<uint32_t> mod8 = {1, 0, 1, 1, 1, 0, 0, 0, 1};
+    Matrix C = Matrix::random(300, 280, 2, 8, mod8);
+    Matrix D = Matrix::random(280, 270, 2, 8, mod8);
+    assert(C.multiply(D, parallel) == C.multiply(D, sequential));
+    
+    // Тест 5: Размер общего пула задаётся только до его создания
+    ThreadPool::global();
+    thrown = false;
+    try {
+        ThreadPool::setGlobalSize(2);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "  ✓ Все тесты пула потоков пройдены\n";
+}
+
+void testParallelElimination() {
+    std::cout << "Тестирование параллельного исключения Гаусса...\n";
+    
+    ThreadPool pool(4);
+    EliminationOptions parallel;
+    parallel.pool = &pool;
+    
+    // Тест 1: Результат совпадает с последовательным алгоритмом
+    // (несколько панелей, неполный ранг, узкие и широкие матрицы)
+    std::vector<uint32_t> mod8 = {1, 0, 1, 1, 1, 0, 0, 0, 1};
+    for (auto dims : {std::pair<size_t, size_t>{150, 170}, std::pair<size_t, size_t>{200, 90},
+                      std::pair<size_t, size_t>{70, 300}}) {
+        std::vector<Matrix> cases = {
+            Matrix::random(dims.first, dims.second, 65521),
+            Matrix::random(dims.first, dims.second, 4294967291ULL),
+            Matrix::random(dims.first, dims.second, 2, 8, mod8),
+            Matrix::random(dims.first, dims.second, 3)
+        };
+        // Неполный ранг: повторяющиеся строки и нулевые столбцы
+        Matrix& low = cases.back();
+        for (size_t i = 0; i < low.rows(); i += 3) {
+            low.setRow(i, low.getRow(i / 2));
+        }
+        for (size_t i = 0; i < low.rows(); ++i) {
+            for (size_t j = 10; j < 80 && j < low.cols(); ++j) {
+                low(i, j) = GFElement(0, 3, 1);
+            }
+        }
+        for (const Matrix& A : cases) {
+            GaussResult serialForward = A.forwardGauss(false);
+            GaussResult blockedForward = A.forwardGauss(parallel);
+            assert(blockedForward.matrix == serialForward.matrix);
+            assert(blockedForward.rank == serialForward.rank);
+            assert(blockedForward.pivotCols == serialForward.pivotCols);
+            
+            GaussResult serialRref = A.reducedRowEchelonForm(false);
+            GaussResult blockedRref = A.reducedRowEchelonForm(parallel);
+            assert(blockedRref.matrix == serialRref.matrix);
+            assert(blockedRref.pivotCols == serialRref.pivotCols);
+            assert(A.rank(parallel) == A.rank());
+        }
+    }
+    
+    // Тест 2: Обращение (блочное и методом Гаусса-Жордана) и вырожденная матрица
+    for (size_t n : {size_t(50), size_t(150)}) {
+        Matrix A = Matrix::random(n, n, 65521);
+        auto inv = A.inverse(parallel);
+        assert(inv.has_value() == A.isInvertible());
+        if (inv) {
+            assert(*inv == *A.inverse());
+        }
+        A.setRow(n - 1, A.getRow(0));
+        assert(!A.inverse(parallel).has_value());
+    }
+    
+    std::cout << "  ✓ Все тесты параллельного исключения пройдены\n";
+}
+
+void testPLUQ() {
+    std::cout << "Тестирование разложения PLUQ...\n";
+    
+    std::vector<uint32_t> mod8 = {1, 0, 1, 1, 1, 0, 0, 0, 1};
+    std::vector<Matrix> cases = {
+        Matrix::random(90, 70, 65521),
+        Matrix::random(60, 140, 7),
+        Matrix::random(80, 80, 2, 8, mod8),
+        Matrix::random(50, 50, 2)
+    };
+    // Неполный ранг: повторяющиеся строки
+    Matrix low = Matrix::random(100, 90, 5);
+    for (size_t i = 1; i < 100; i += 2) {
+        low.setRow(i, low.getRow(i / 3));
+    }
+    cases.push_back(low);
+    
+    for (const Matrix& A : cases) {
+        PLUQ f = A.pluq();
+        const Field& field = A.field();
+        
+        // Тест 1: A = P L U Q, профили ранга
+        assert(f.P() * f.L() * f.U() * f.Q() == A);
+        assert(f.rank() == A.rank());
+        assert(f.columnRankProfile() == A.forwardGauss(false).pivotCols);
+        std::vector<size_t> rowProfile;
+        for (size_t i = 0, r = 0; i < A.rows(); ++i) {
+            std::vector<size_t> prefix(i + 1), all(A.cols());
+            std::iota(prefix.begin(), prefix.end(), 0);
+            std::iota(all.begin(), all.end(), 0);
+            size_t rankPrefix = A.submatrix(prefix, all).rank();
+            if (rankPrefix > r) {
+                rowProfile.push_back(i);
+                r = rankPrefix;
+            }
+        }
+        assert(f.rowRankProfile() == rowProfile);
+        
+        // Тест 2: Совместная система и несколько правых частей
+        Matrix X0 = Matrix::random(A.cols(), 3, field.p(), field.m(), field.modulus());
+        Matrix B = A * X0;
+        auto X = f.solve(B);
+        assert(X.has_value() && A * (*X) == B);
+        std::vector<GFElement> b = B.getCol(0);
+        auto x = f.solve(b);
+        assert(x.has_value() && A * (*x) == b);
+        
+        // Тест 3: Ядро
+        Matrix N = f.nullspace();
+        assert(N.cols() == A.cols() - f.rank());
+        if (N.cols() > 0) {
+            assert((A * N) == Matrix(A.rows(), N.cols(), field));
+            assert(N.rank() == N.cols());
+        }
+        
+        // Тест 4: Несовместная система (неполный ранг по строкам)
+        if (f.rank() < A.rows()) {
+            std::vector<size_t> profile = f.rowRankProfile();
+            size_t dependent = 0;
+            while (std::binary_search(profile.begin(), profile.end(), dependent)) {
+                ++dependent;
+            }
+            std::vector<GFElement> bad = b;
+            bad[dependent] = bad[dependent] + GFElement(field, 1);
+            assert(!f.solve(bad).has_value());
+        }
+    }
+    
+    // Тест 5: Определитель и обратная матрица
+    Matrix A = Matrix::random(70, 70, 65521);
+    Matrix C = Matrix::random(70, 70, 65521);
+    PLUQ fa = A.pluq();
+    assert((A * C).pluq().determinant() == fa.determinant() * C.pluq().determinant());
+    assert(fa.determinant().isZero() == !A.isInvertible());
+    if (A.isInvertible()) {
+        assert(*fa.inverse() == *A.inverse());
+    }
+    Matrix S({{0, 1, 0}, {1, 0, 0}, {0, 0, 1}}, 5, 1);
+    assert(S.pluq().determinant() == GFElement(4, 5, 1));
+    Matrix singular({{1, 2}, {2, 4}}, 5, 1);
+    assert(singular.pluq().determinant().isZero());
+    assert(!singular.pluq().inverse().has_value());
+    
+    std::cout << "  ✓ Все тесты разложения PLUQ пройдены\n";
+}
+
+void testSolve() {
+    std::cout << "Тестирование решения систем с многими правыми частями...\n";
+    
+    // Тест 1: Совместные системы, больше блока подстановок (64)
+    for (uint64_t p : {uint64_t(65521), uint64_t(3)}) {
+        Matrix A = Matrix::random(150, 130, p);
+        Matrix X0 = Matrix::random(130, 260, p);
+        Matrix B = A * X0;
+        SolveResult result = solve(A, B);
+        assert(result.consistent());
+        assert(result.rank == A.rank());
+        assert(A * result.solution == B);
+        assert(result.nullspace.cols() == 130 - result.rank);
+    }
+    
+    // Тест 2: Неполный ранг - часть систем несовместна, общее решение
+    Matrix A = Matrix::random(120, 100, 7);
+    for (size_t i = 60; i < 120; ++i) {
+        A.setRow(i, A.getRow(i - 60));
+    }
+    Matrix B = A * Matrix::random(100, 10, 7);
+    std::vector<GFElement> col = B.getCol(3);
+    col[100] = col[100] + GFElement(1, 7, 1);
+    for (size_t i = 0; i < 120; ++i) {
+        B(i, 3) = col[i];
+        B(i, 8) = GFElement(i == 70 ? 1 : 0, 7, 1);
+    }
+    SolveResult result = solve(A, B);
+    assert(!result.consistent());
+    assert((result.inconsistentColumns == std::vector<size_t>{3, 8}));
+    assert(result.nullspace.cols() == 100 - result.rank);
+    Matrix general = result.solution + result.nullspace * Matrix::random(result.nullspace.cols(), 10, 7);
+    Matrix residual = A * general - B;
+    for (size_t t = 0; t < 10; ++t) {
+        bool zero = true;
+        for (size_t i = 0; i < 120; ++i) {
+            zero = zero && residual(i, t).isZero();
+        }
+        assert(zero == (t != 3 && t != 8));
+    }
+    
+    // Тест 3: Несовпадение размеров
+    bool thrown = false;
+    try {
+        solve(A, Matrix::random(5, 2, 7));
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "  ✓ Все тесты решения систем пройдены\n";
+}
+
+void testSparseMatrix() {
+    std::cout << "Тестирование разреженных матриц...\n";
+    
+    const Field& gf7 = Field::get(7);
+    
+    // Тест 1: Преобразования и доступ
+    Matrix D = Matrix::random(9, 12, 7);
+    for (size_t i = 0; i < 9; ++i) {
+        for (size_t j = 0; j < 12; ++j) {
+            if ((i + j) % 3 != 0) D(i, j) = GFElement(gf7);
+        }
+    }
+    SparseMatrix S = SparseMatrix::fromMatrix(D);
+    assert(S.toMatrix() == D);
+    assert(S.get(3, 6) == D(3, 6));
+    assert(S.transpose() == SparseMatrix::fromMatrix(D.transpose()));
+    assert(S.transpose().transpose() == S);
+    std::vector<GFElement> v = Matrix::random(12, 1, 7).getCol(0);
+    assert(S * v == D * v);
+    
+    // Повторы суммируются, нули отбрасываются
+    SparseMatrix E(2, 3, gf7, {{1, 2, GFElement(gf7, 3)}, {0, 0, GFElement(gf7, 5)},
+                               {1, 2, GFElement(gf7, 4)}, {0, 1, GFElement(gf7, 2)}});
+    assert(E.nonZeros() == 2);
+    assert(E.get(1, 2).isZero() && E.get(0, 0).getValue() == 5);
+    bool thrown = false;
+    try {
+        SparseMatrix(2, 2, gf7, {{2, 0, GFElement(gf7, 1)}});
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    // Тест 2: Ранг, решение и ядро совпадают с плотным исключением
+    auto randomSparse = [](size_t rows, size_t cols, size_t perCol, const Field& field,
+                           uint32_t seed) {
+        std::vector<SparseEntry> entries;
+        for (size_t j = 0; j < cols; ++j) {
+            for (size_t t = 0; t < perCol; ++t) {
+                seed = seed * 1103515245u + 12345u;
+                size_t row = (seed >> 8) % rows;
+                uint64_t value = 1 + (seed >> 4) % field.maxValue();
+                entries.push_back({row, j, GFElement(field, value)});
+            }
+        }
+        return SparseMatrix(rows, cols, field, entries);
+    };
+    for (uint32_t seed = 1; seed <= 10; ++seed) {
+        // Малые матрицы сразу исключаются плотно, большие - сначала разреженно
+        size_t n = seed <= 5 ? 40 : 400;
+        SparseMatrix A = randomSparse(n * 3 / 4 + seed, n, 2, gf7, seed);
+        Matrix dense = A.toMatrix();
+        size_t r = A.rank();
+        assert(r == dense.rank());
+        
+        Matrix N = A.nullspace();
+        assert(N.cols() == n - r);
+        assert(N.rank() == N.cols());
+        assert(dense * N == Matrix(dense.rows(), N.cols(), gf7));
+        
+        std::vector<GFElement> b = A * Matrix::random(n, 1, 7).getCol(0);
+        auto x = A.solve(b);
+        assert(x && A * *x == b);
+        
+        std::vector<GFElement> c = Matrix::random(dense.rows(), 1, 7).getCol(0);
+        assert(A.solve(c).has_value() == dense.pluq().solve(c).has_value());
+    }
+    
+    // Тест 3: Проверочная матрица кода LDPC над GF(2) и GF(65521)
+    SparseMatrix H = randomSparse(1500, 3000, 3, Field::get(2), 7);
+    size_t r = H.rank();
+    assert(r == H.toMatrix().rank());
+    std::vector<GFElement> codeword = Matrix::random(3000, 1, 2).getCol(0);
+    std::vector<GFElement> syndrome = H * codeword;
+    auto x = H.solve(syndrome);
+    assert(x && H * *x == syndrome);
+    
+    SparseMatrix G = randomSparse(600, 500, 4, Field::get(65521), 3);
+    Matrix N = G.nullspace();
+    assert(N.cols() == 500 - G.rank());
+    assert(G.toMatrix() * N == Matrix(600, N.cols(), Field::get(65521)));
+
+    // Широкая проверочная матрица над GF(65521): столбцов втрое больше строк
+    SparseMatrix W = randomSparse(400, 1200, 3, Field::get(65521), 11);
+    Matrix denseW = W.toMatrix();
+    size_t rw = W.rank();
+    assert(rw == denseW.rank());
+    assert(rw == W.transpose().rank());
+    Matrix NW = W.nullspace();
+    assert(NW.cols() == 1200 - rw);
+    assert(NW.rank() == NW.cols());
+    assert(denseW * NW == Matrix(400, NW.cols(), Field::get(65521)));
+    std::vector<GFElement> sw = W * Matrix::random(1200, 1, 65521).getCol(0);
+    auto xw = W.solve(sw);
+    assert(xw && W * *xw == sw);
+
+    // Нулевая матрица: ядро - всё пространство
+    SparseMatrix Z(4, 3, gf7);
+    assert(Z.rank() == 0);
+    assert(Z.nullspace() == Matrix::identity(3, 7));
+    assert(!Z.solve(std::vector<GFElement>{GFElement(gf7), GFElement(gf7, 1),
+                                           GFElement(gf7), GFElement(gf7)}));
+    
+    std::cout << "  ✓ Все тесты разреженных матриц пройдены\n";
+}
+
+void testWiedemann() {
+    std::cout << "Тестирование метода Видемана...\n";
+    
+    // Тест 1: Берлекэмп-Мэсси для последовательности Фибоначчи по модулю 7
+    const Field& gf7 = Field::get(7);
+    std::vector<GFElement> fib{GFElement(gf7, 0), GFElement(gf7, 1)};
+    for (size_t i = 2; i < 10; ++i) {
+        fib.push_back(fib[i - 1] + fib[i - 2]);
+    }
+    std::vector<GFElement> poly = berlekampMassey(fib);
+    assert(poly.size() == 3);
+    assert(poly[0].getValue() == 6 && poly[1].getValue() == 6 && poly[2].getValue() == 1);
+    
+    // Тест 2: Невырожденные разреженные системы над GF(p), GF(2) и GF(2^8)
+    // Треугольная матрица с единичной диагональю и переставленными строками
+    auto randomNonsingular = [](size_t n, size_t perRow, const Field& field, uint32_t seed) {
+        std::vector<size_t> perm(n);
+        std::iota(perm.begin(), perm.end(), 0);
+        std::shuffle(perm.begin(), perm.end(), std::mt19937(seed));
+        std::vector<SparseEntry> entries;
+        for (size_t i = 0; i < n; ++i) {
+            entries.push_back({perm[i], i, GFElement(field, 1)});
+            for (size_t t = 0; t < perRow && i + 1 < n; ++t) {
+                seed = seed * 1103515245u + 12345u;
+                uint64_t value = 1 + (seed >> 4) % field.maxValue();
+                entries.push_back({perm[i], i + 1 + (seed >> 8) % (n - i - 1), GFElement(field, value)});
+            }
+        }
+        return SparseMatrix(n, n, field, entries);
+    };
+    const Field* fields[] = {&Field::get(65521), &Field::get(2),
+                             &Field::get(2, 8, {1, 0, 1, 1, 1, 0, 0, 0, 1})};
+    size_t sizes[] = {200, 150, 60};
+    for (size_t k = 0; k < 3; ++k) {
+        const Field& field = *fields[k];
+        SparseMatrix A = randomNonsingular(sizes[k], 3, field, 11 + k);
+        Matrix x0 = Matrix::random(sizes[k], 1, field.p(), field.m(), field.modulus());
+        std::vector<GFElement> b = A * x0.getCol(0);
+        WiedemannOptions options;
+        options.seed = 5 + k;
+        auto x = wiedemannSolve(A, b, options);
+        assert(x && *x == x0.getCol(0));
+    }
+    
+    // Тест 3: Вырожденная матрица (нулевая строка) и несовместная правая часть
+    SparseMatrix S(3, 3, gf7, {{0, 0, GFElement(gf7, 2)}, {1, 2, GFElement(gf7, 3)}});
+    assert(!wiedemannSolve(S, {GFElement(gf7, 1), GFElement(gf7, 1), GFElement(gf7, 1)}));
+    
+    // Тест 4: Неквадратная матрица
+    bool thrown = false;
+    try {
+        wiedemannSolve(SparseMatrix(2, 3, gf7), {GFElement(gf7), GFElement(gf7)});
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "  ✓ Все тесты метода Видемана пройдены\n";
+}
+
+void testIncrementalEchelon() {
+    std::cout << "Тестирование пополняемого ступенчатого базиса...\n";
+    
+    // Тест 1: Сетевое кодирование над GF(2^8): 12 исходных пакетов по 16 символов
+    std::vector<uint32_t> mod8 = {1, 0, 1, 1, 1, 0, 0, 0, 1};
+    const Field& gf256 = Field::get(2, 8, mod8);
+    Matrix sources = Matrix::random(12, 16, 2, 8, mod8);
+    for (bool progressive : {true, false}) {
+        IncrementalEchelon decoder(12, gf256, 16, progressive);
+        std::vector<std::vector<GFElement>> received;
+        while (!decoder.isFullRank()) {
+            // Каждый третий пакет - комбинация уже полученных
+            Matrix c = Matrix::random(1, 12, 2, 8, mod8);
+            if (received.size() % 3 == 2) {
+                for (size_t j = 0; j < 12; ++j) {
+                    c(0, j) = received[0][j] + received[1][j];
+                }
+            }
+            std::vector<GFElement> coefficients = c.getRow(0);
+            size_t before = decoder.rank();
+            bool innovative = decoder.addRow(coefficients, (c * sources).getRow(0));
+            received.push_back(coefficients);
+            assert(decoder.rank() == Matrix(received).rank());
+            assert(innovative == (decoder.rank() == before + 1));
+        }
+        assert(*decoder.solution() == sources);
+        assert(decoder.decoded(5) == sources.getRow(5));
+        assert(!decoder.addRow(received.back(), (Matrix({received.back()}) * sources).getRow(0)));
+    }
+    
+    // Тест 2: Прогрессивное декодирование над GF(7)
+    const Field& gf7 = Field::get(7);
+    auto element = [&](uint64_t v) { return GFElement(gf7, v); };
+    IncrementalEchelon decoder(3, gf7, 1);
+    assert(decoder.addRow({element(0), element(0), element(2)}, {element(4)}));
+    assert(decoder.decoded(2) == std::vector<GFElement>{element(2)});
+    assert(decoder.addRow({element(1), element(1), element(1)}, {element(3)}));
+    assert(!decoder.decoded(0) && !decoder.decoded(1));
+    assert(!decoder.addRow({element(2), element(2), element(0)}, {element(2)}));
+    assert(!decoder.solution());
+    assert(decoder.addRow({element(0), element(3), element(0)}, {element(6)}));
+    assert(decoder.decoded(0) == std::vector<GFElement>{element(6)});
+    assert(decoder.decoded(1) == std::vector<GFElement>{element(2)});
+    assert(decoder.basis().rows() == 3);
+    
+    // Тест 3: Несовпадение размера строки
+    bool thrown = false;
+    try {
+        decoder.addRow({element(1)}, {element(1)});
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "  ✓ Все тесты пополняемого базиса пройдены\n";
+}
+
+void testInverseTracker() {
+    std::cout << "Тестирование обновления обратной матрицы...\n";
+    
+    // Тест 1: Случайные замены строк и столбцов и обновления ранга 1
+    std::vector<uint32_t> mod8 = {1, 0, 1, 1, 1, 0, 0, 0, 1};
+    for (int k = 0; k < 2; ++k) {
+        uint64_t p = k == 0 ? 65521 : 2;
+        uint32_t m = k == 0 ? 1 : 8;
+        std::vector<uint32_t> modulus = k == 0 ? std::vector<uint32_t>{1, 1} : mod8;
+        size_t n = 40;
+        Matrix A = Matrix::random(n, n, p, m, modulus);
+        while (!A.isInvertible()) {
+            A = Matrix::random(n, n, p, m, modulus);
+        }
+        auto tracker = InverseTracker::create(A);
+        assert(tracker);
+        Matrix I = Matrix::identity(n, p, m, modulus);
+        
+        for (int step = 0; step < 30; ++step) {
+            Matrix before = tracker->matrix();
+            Matrix expected = before;
+            bool accepted = false;
+            std::vector<GFElement> vec = Matrix::random(n, 1, p, m, modulus).getCol(0);
+            size_t index = static_cast<size_t>(step * 7) % n;
+            if (step % 3 == 0) {
+                expected.setRow(index, vec);
+                accepted = tracker->replaceRow(index, vec);
+            } else if (step % 3 == 1) {
+                for (size_t i = 0; i < n; ++i) expected(i, index) = vec[i];
+                accepted = tracker->replaceColumn(index, vec);
+            } else {
+                std::vector<GFElement> u = Matrix::random(n, 1, p, m, modulus).getCol(0);
+                for (size_t i = 0; i < n; ++i) {
+                    for (size_t j = 0; j < n; ++j) expected(i, j) = expected(i, j) + u[i] * vec[j];
+                }
+                accepted = tracker->rankOneUpdate(u, vec);
+            }
+            assert(accepted == expected.isInvertible());
+            assert(tracker->matrix() == (accepted ? expected : before));
+            assert(tracker->matrix() * tracker->inverse() == I);
+            assert(tracker->determinant() == tracker->matrix().pluq().determinant());
+        }
+        
+        // Тест 2: Замена строки копией другой строки делает матрицу вырожденной
+        Matrix before = tracker->matrix();
+        assert(!tracker->replaceRow(0, before.getRow(1)));
+        assert(!tracker->replaceColumn(2, before.getCol(3)));
+        assert(tracker->matrix() == before);
+    }
+    
+    // Тест 3: Вырожденная и неквадратная матрицы не отслеживаются
+    assert(!InverseTracker::create(Matrix({{1, 2}, {2, 4}}, 5, 1)));
+    assert(!InverseTracker::create(Matrix(2, 3, 5, 1)));
+    
+    std::cout << "  ✓ Все тесты обновления обратной матрицы пройдены\n";
+}
+
+void testRegionOps() {
+    std::cout << "Тестирование операций над строками GF(2^8)/GF(2^16) ("
+              << regionKernelName() << ")...\n";
+    
+    std::mt19937_64 gen(11);
+    const Field& gf256 = Field::get(2, 8, {1, 0, 1, 1, 1, 0, 0, 0, 1});
+    std::vector<uint32_t> mod16(17, 0);
+    mod16[0] = mod16[2] = mod16[3] = mod16[5] = mod16[16] = 1;  // x^16 + x^5 + x^3 + x^2 + 1
+    const Field& gf65536 = Field::get(2, 16, mod16);
+    
+    // Длины покрывают основные циклы всех векторных ядер и скалярные хвосты
+    for (size_t n = 0; n < 200; n += 7) {
+        // Тест 1: GF(2^8), dest += c * src и dest = c * src
+        std::vector<uint8_t> src8(n), dest8(n);
+        for (size_t i = 0; i < n; ++i) {
+            src8[i] = static_cast<uint8_t>(gen());
+            dest8[i] = static_cast<uint8_t>(gen());
+        }
+        uint8_t c8 = static_cast<uint8_t>(gen() | 2);
+        std::vector<uint8_t> expected8(n);
+        for (size_t i = 0; i < n; ++i) {
+            expected8[i] = static_cast<uint8_t>(dest8[i] ^ gf256.mul(c8, src8[i]));
+        }
+        regionMultiplyAdd(gf256, dest8.data(), src8.data(), c8, n);
+        assert(dest8 == expected8);
+        regionMultiply(gf256, dest8.data(), dest8.data(), c8, n);
+        for (size_t i = 0; i < n; ++i) {
+            assert(dest8[i] == gf256.mul(c8, expected8[i]));
+        }
+        
+        // Тест 2: GF(2^16)
+        std::vector<uint16_t> src16(n), dest16(n);
+        for (size_t i = 0; i < n; ++i) {
+            src16[i] = static_cast<uint16_t>(gen());
+            dest16[i] = static_cast<uint16_t>(gen());
+        }
+        uint16_t c16 = static_cast<uint16_t>(gen() | 2);
+        std::vector<uint16_t> expected16(n);
+        for (size_t i = 0; i < n; ++i) {
+            expected16[i] = static_cast<uint16_t>(dest16[i] ^ gf65536.mul(c16, src16[i]));
+        }
+        regionMultiplyAdd(gf65536, dest16.data(), src16.data(), c16, n);
+        assert(dest16 == expected16);
+        regionMultiply(gf65536, dest16.data(), dest16.data(), c16, n);
+        for (size_t i = 0; i < n; ++i) {
+            assert(dest16[i] == gf65536.mul(c16, expected16[i]));
+        }
+    }
+    
+    // Тест 3: Неподходящее поле
+    bool thrown = false;
+    uint8_t byte = 0;
+    try {
+        regionMultiply(Field::get(3), &byte, &byte, 1, 1);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "  ✓ Все тесты операций над строками пройдены\n";
+}
+
+// Сравнение арифметики GF<P, M, Poly> с контекстом Field на случайных парах
+template <typename F>
+void checkStaticField(std::mt19937_64& gen, size_t samples) {
+    const Field& field = F::field();
+    for (size_t t = 0; t < samples; ++t) {
+        uint64_t x = gen() % F::kOrder, y = gen() % F::kOrder;
+        F a(x), b(y);
+        assert((a + b).value() == field.add(x, y));
+        assert((a - b).value() == field.sub(x, y));
+        assert((a * b).value() == field.mul(x, y));
+        assert((-a).value() == field.neg(x));
+        if (y != 0) {
+            assert((a / b).value() == field.div(x, y));
+            assert((b * b.inverse()).isOne());
+        }
+    }
+}
+
+void testStaticField() {
+    std::cout << "Тестирование полей, заданных при компиляции...\n";
+    
+    // Тест 1: Вычисления во время компиляции
+    static_assert(GF256::kHasTables, "GF(2^8) должно использовать таблицы");
+    static_assert((GF256(0x53) * GF256(0xCA)).value() == GF256::mul(0x53, 0xCA), "");
+    static_assert((GF256(0x53) * GF256(0x53).inverse()).isOne(), "");
+    static_assert((GF3(2) * GF3(2)).isOne(), "");
+    static_assert(GF65521(65520).inverse() == GF65521(65520), "");
+    static_assert(sizeof(GF256) == 1 && sizeof(GF65536) == 2 && sizeof(GF65521) == 2, "");
+    
+    // Тест 2: Совпадение с Field для полей с таблицами и без
+    std::mt19937_64 gen(5);
+    checkStaticField<GF2>(gen, 100);
+    checkStaticField<GF3>(gen, 100);
+    checkStaticField<GF256>(gen, 2000);
+    checkStaticField<GF65536>(gen, 2000);
+    checkStaticField<GF65521>(gen, 2000);
+    checkStaticField<GF<2, 12, 0x1053>>(gen, 2000);              // x^12 + x^6 + x^4 + x + 1
+    checkStaticField<GF<3, 4, 86>>(gen, 2000);                   // x^4 + x + 2
+    checkStaticField<GF<5, 9, 1953125 + 25 + 2 * 5 + 3>>(gen, 200);  // x^9 + x^2 + 2x + 3 (без таблиц)
+    
+    // Тест 3: Преобразование в GFElement и обратно
+    GF256 a(0x1D);
+    GFElement e = a.toElement();
+    assert(&e.field() == &GF256::field());
+    assert(e.getValue() == 0x1D);
+    assert(GF256::fromElement(e) == a);
+    bool thrown = false;
+    try {
+        GF256::fromElement(GFElement(1, 2, 1));
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "  ✓ Все тесты полей, заданных при компиляции, пройдены\n";
+}
+
+// Проверка StaticMatrix<F> против Matrix над тем же полем
+template <typename F>
+void checkStaticMatrix(size_t n) {
+    Matrix A = Matrix::random(n, n + 3, F::kCharacteristic, F::kDegree, F::modulusCoeffs());
+    Matrix B = Matrix::random(n + 3, n, F::kCharacteristic, F::kDegree, F::modulusCoeffs());
+    auto SA = StaticMatrix<F>::fromMatrix(A);
+    auto SB = StaticMatrix<F>::fromMatrix(B);
+    assert(SA.toMatrix() == A);
+    assert((SA * SB).toMatrix() == A * B);
+    assert((SA + SA).toMatrix() == A + A);
+    assert(SA.transpose().toMatrix() == A.transpose());
+    assert(SA.rank() == A.rank());
+    assert(SA.reducedRowEchelonForm().matrix.toMatrix() ==
+           A.reducedRowEchelonForm().matrix);
+    
+    auto product = SA * SB;
+    auto inv = product.inverse();
+    assert(inv.has_value() == (A * B).isInvertible());
+    if (inv) {
+        assert(product * (*inv) == StaticMatrix<F>::identity(n));
+    }
+}
+
+void testStaticMatrix() {
+    std::cout << "Тестирование матриц над полями, заданными при компиляции...\n";
+    
+    // Тест 1: Совпадение с Matrix
+    checkStaticMatrix<GF2>(20);
+    checkStaticMatrix<GF3>(12);
+    checkStaticMatrix<GF256>(37);
+    checkStaticMatrix<GF65536>(21);
+    checkStaticMatrix<GF65521>(15);
+    
+    // Тест 2: Элементарные преобразования строк
+    StaticMatrixGF256 M({{1, 2, 3}, {4, 5, 6}});
+    M.addRow(1, 0, GF256(7));
+    assert(M(1, 0) == GF256(4) + GF256(7) * GF256(1));
+    assert(M(1, 2) == GF256(6) + GF256(7) * GF256(3));
+    M.multiplyRow(0, GF256(2));
+    assert(M(0, 1) == GF256(4));
+    M.swapRows(0, 1);
+    assert(M(1, 2) == GF256(6));
+    
+    // Тест 3: Вырожденная матрица и чужое поле
+    StaticMatrixGF65521 S({{1, 2}, {2, 4}});
+    assert(!S.inverse().has_value());
+    assert(S.rank() == 1);
+    bool thrown = false;
+    try {
+        StaticMatrixGF256::fromMatrix(Matrix::identity(2));
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "  ✓ Все тесты матриц над полями, заданными при компиляции, пройдены\n";
+}
+
+void testBitMatrix() {
+    std::cout << "Тестирование упакованных матриц над GF(2)...\n";
+    
+    // Тест 1: Преобразование Matrix <-> BitMatrix
+    Matrix A({{1, 0, 1}, {0, 1, 1}, {1, 1, 1}}, 2, 1);
+    BitMatrix BA = BitMatrix::fromMatrix(A);
+    assert(BA.get(0, 0) && !BA.get(0, 1) && BA.get(2, 2));
+    assert(BA.toMatrix() == A);
+    
+    // Тест 2: Умножение совпадает с обычной матрицей
+    Matrix B({{1, 1, 0}, {0, 1, 0}, {1, 0, 1}}, 2, 1);
+    BitMatrix BB = BitMatrix::fromMatrix(B);
+    assert((BA * BB).toMatrix() == A * B);
+    
+    // Тест 3: Ранг и ступенчатый вид
+    assert(BA.rank() == A.rank());
+    auto bitGauss = BA.reducedRowEchelonForm();
+    auto gauss = A.reducedRowEchelonForm(false);
+    assert(bitGauss.matrix.toMatrix() == gauss.matrix);
+    assert(bitGauss.pivotCols == gauss.pivotCols);
+    
+    // Тест 4: Обратная матрица (включая строки длиннее одного слова)
+    auto invA = BA.inverse();
+    assert(invA.has_value());
+    assert(BA * (*invA) == BitMatrix::identity(3));
+    
+    BitMatrix R = BitMatrix::random(130, 130);
+    for (size_t i = 0; i < 130; ++i) {
+        R.set(i, i, true);
+        for (size_t j = 0; j < i; ++j) R.set(i, j, false);
+    }
+    auto invR = R.inverse();
+    assert(invR.has_value());
+    assert(R * (*invR) == BitMatrix::identity(130));
+    
+    // Тест 5: Вырожденная матрица
+    BitMatrix S({{1, 1}, {1, 1}});
+    assert(S.rank() == 1);
+    assert(!S.inverse().has_value());
+    
+    // Тест 6: Умножение методом четырёх русских (неполные блоки и таблицы)
+    for (auto dims : {std::vector<size_t>{200, 150, 300}, std::vector<size_t>{130, 1100, 70},
+                      std::vector<size_t>{129, 61, 4200}}) {
+        BitMatrix X = BitMatrix::random(dims[0], dims[1]);
+        BitMatrix Y = BitMatrix::random(dims[1], dims[2]);
+        BitMatrix Z = X * Y;
+        BitMatrix YT = Y.transpose();
+        for (size_t i = 0; i < dims[0]; i += 7) {
+            for (size_t j = 0; j < dims[2]; ++j) {
+                uint64_t parity = 0;
+                for (size_t w = 0; w < X.words(); ++w) {
+                    parity ^= X.row(i)[w] & YT.row(j)[w];
+                }
+                assert(Z.get(i, j) == (std::bitset<64>(parity).count() % 2 == 1));
+            }
+        }
+    }
+    
+    // Тест 7: M4RI совпадает с поэлементным исключением (учебный режим)
+    std::mt19937_64 gen(17);
+    for (auto dims : {std::vector<size_t>{40, 70}, std::vector<size_t>{200, 130},
+                      std::vector<size_t>{90, 300}}) {
+        // Матрица неполного ранга: произведение через узкую внутреннюю размерность
+        size_t inner = dims[0] / 2 + gen() % 10;
+        Matrix M = Matrix::random(dims[0], inner, 2) * Matrix::random(inner, dims[1], 2);
+        for (size_t i = 0; i < dims[0]; i += 3) {
+            M.setRow(i, Matrix::random(1, dims[1], 2).getRow(0));
+        }
+        auto fast = M.forwardGauss();
+        auto classic = M.forwardGauss(true);
+        assert(fast.matrix == classic.matrix);
+        assert(fast.pivotCols == classic.pivotCols && fast.rank == classic.rank);
+        auto fastRref = M.reducedRowEchelonForm();
+        auto classicRref = M.reducedRowEchelonForm(true);
+        assert(fastRref.matrix == classicRref.matrix);
+        assert(fastRref.pivotCols == classicRref.pivotCols);
+        assert(M.rank() == classic.rank);
+    }
+    Matrix Q = Matrix::random(200, 200, 2);
+    auto invQ = Q.inverse();
+    assert(invQ.has_value() == Q.isInvertible());
+    if (invQ) {
+        assert(Q * (*invQ) == Matrix::identity(200));
+    }
+    
+    // Тест 8: Matrix над GF(2) умножается через BitMatrix
+    Matrix MX = Matrix::random(140, 90, 2);
+    Matrix MY = Matrix::random(90, 100, 2);
+    Matrix MZ = MX * MY;
+    for (size_t i = 0; i < 140; i += 13) {
+        for (size_t j = 0; j < 100; ++j) {
+            uint32_t sum = 0;
+            for (size_t k = 0; k < 90; ++k) {
+                sum ^= static_cast<uint32_t>(MX(i, k).getValue() & MY(k, j).getValue());
+            }
+            assert(MZ(i, j).getValue() == sum);
+        }
+    }
+    
+    std::cout << "  ✓ Все тесты упакованных матриц пройдены\n";
+}
+
 int main() {
     std::cout << "\n=== Запуск тестов модуля matrix_gf2 ===\n\n";
     
@@ -243,6 +1542,26 @@ int main() {
         testGF3();
         testSubmatrix();
         testRowOperations();
+        testMatrixStorage();
+        testMatrixViews();
+        testField();
+        testLogTables();
+        testPrimeInverse();
+        testLargePrimeFields();
+        testBinaryExtensionFields();
+        testFastMultiplication();
+        testThreadPool();
+        testParallelElimination();
+        testPLUQ();
+        testSolve();
+        testSparseMatrix();
+        testWiedemann();
+        testIncrementalEchelon();
+        testInverseTracker();
+        testRegionOps();
+        testStaticField();
+        testStaticMatrix();
+        testBitMatrix();
         
         std::cout << "\n✓✓✓ ВСЕ ТЕСТЫ УСПЕШНО ПРОЙДЕНЫ ✓✓✓\n\n";
         return 0;